@@ -17,17 +17,13 @@
  extern enum CosTW;
 
  /// <summary>
- ///     
+ ///     
  /// <summary>
- /// <param name="dirName">  . </param>
+ /// <param name="path">   (MAX_PATH ). </param>
+ /// <param name="dirName">   (NULL - ). </param>
  /// <param name="fileName">  . </param>
- /// <param name="toWrite">    ? </param>
- FILE * GetStreamPointer(char *dirName, char *fileName, bool toWrite)
+ void GetFullPath(char *path, char *dirName, char *fileName)
  {
-     //     
-     char path[MAX_PATH];
-
-     //   
      if(dirName != NULL)
      {
         strcpy(path, dirName);
@@ -38,6 +34,21 @@
      {
         strcpy(path, fileName);
      }
+ }
+
+ /// <summary>
+ ///     
+ /// <summary>
+ /// <param name="dirName">  . </param>
+ /// <param name="fileName">  . </param>
+ /// <param name="toWrite">    ? </param>
+ FILE * GetStreamPointer(char *dirName, char *fileName, bool toWrite)
+ {
+     //     
+     char path[MAX_PATH];
+
+     //   
+     GetFullPath(path, dirName, fileName);
 
      //   
      return fopen(path, toWrite ? "wb" : "rb");
@@ -97,13 +108,29 @@
      return log(arg) / log(logBase);
  }
 
+ /// <summary>
+ ///     2 (  )
+ /// </summary>
+ /// <param name="arg">   ( ). </param>
+ int Log2Int(int arg)
+ {
+     int log2 = 0;
+
+     while((arg >>= 1) != 0)
+     {
+         ++log2;
+     }
+
+     return log2;
+ }
+
  /// <summary>
  ///       
  /// </summary>
  /// <param name="arg">  . </param>
  int ToLowerPowerOf2(int arg)
  {
-     return (int)pow(2, (int)(LogX(arg, 2)));
+     return (arg > 0) ? (1 << Log2Int(arg)) : 0;
  }
 
  /// <summary>
@@ -138,9 +165,11 @@
  /// <param name="phase">    . </param>
  double PhaseNorm(double phase)
  {
-     if(phase > 0) while (phase >= M_PI)  phase -= M_2PI;
-              else while (phase <= -M_PI) phase += M_2PI;
- 
+     //    (-2pi, 2pi)    - 
+     //  (     2pi)
+     phase -= M_2PI * (double)(int)(phase * (1.0 / (M_2PI)));
+     phase -= M_2PI * (double)((phase >= M_PI) - (phase <= -M_PI));
+
      return phase;
  }
 
@@ -154,38 +183,124 @@
      return (((re < 0) ? -re : re) < FLOAT_MIN) ? 0 : atan2(im, re);
  }
 
+ //   atan(a) = a * P(a^2)  [0, 1] ( ,
+ //  ~6E-8 )
+ #define ATAN_C0   0.99999988199649226
+ #define ATAN_C1  -0.33331812655625559
+ #define ATAN_C2   0.19966961829580465
+ #define ATAN_C3  -0.14003290184666506
+ #define ATAN_C4   0.098688654583183322
+ #define ATAN_C5  -0.058829753147211505
+ #define ATAN_C6   0.023780518600887035
+ #define ATAN_C7  -0.0045597919873330284
+
  /// <summary>
- ///        FFT
+ ///     ( < 1E-7 ),
+ ///    -   Safe_atan2
  /// </summary>
- /// <param name="fftObj">  FFT,    . </param>
- void fill_FFT_P(CFFT_Object *fftObj)
+ /// <param name="im">    . </param>
+ /// <param name="re">    . </param>
+ double Fast_atan2(double im, double re)
  {
-     int i, j, shift;
+     double ax, ay, a, t, r;
 
-     //      FFT...
-     SAFE_DELETE(fftObj->FFT_P);
-     fftObj->FFT_P = (int *)calloc(fftObj->NN, sizeof(int));
+     ax = (re < 0) ? -re : re;
+     ay = (im < 0) ? -im : im;
+
+     if(ax < FLOAT_MIN)
+     {
+         return 0;
+     }
 
-     //   ...
-     memset(fftObj->FFT_P, 0x00, (fftObj->NN * sizeof(int)));
+     //   [0, 1]: atan(y / x) = pi / 2 - atan(x / y)
+     a = (ax >= ay) ? (ay / ax) : (ax / ay);
+     t = a * a;
+     r = a * (ATAN_C0 + t * (ATAN_C1 + t * (ATAN_C2 + t * (ATAN_C3 +
+             t * (ATAN_C4 + t * (ATAN_C5 + t * (ATAN_C6 + t * ATAN_C7)))))));
 
-     //      ...
-     for(j = 0; j < LogX(fftObj->N, 2); ++j)
+     r = (ay > ax) ? ((M_PI / 2) - r) : r;
+     r = (re < 0)  ? (M_PI - r) : r;
+
+     return (im < 0) ? -r : r;
+ }
+
+ /// <summary>
+ ///    double,   SIMD_ALIGN 
+ /// (     )
+ /// </summary>
+ /// <param name="count">  . </param>
+ /// <returns>    (NULL -  ). </returns>
+ double * CFFT_AlignedAlloc(int count)
+ {
+     unsigned char *base, *ptr;
+
+     base = (unsigned char *)calloc((count * sizeof(double)) +
+                                    SIMD_ALIGN + sizeof(void *), 1);
+
+     if(base == NULL)
+     {
+         return NULL;
+     }
+
+     ptr  = base + sizeof(void *);
+     ptr += (SIMD_ALIGN - ((size_t)ptr & (SIMD_ALIGN - 1))) & (SIMD_ALIGN - 1);
+     ((void **)ptr)[-1] = base;
+
+     return (double *)ptr;
+ }
+
+ /// <summary>
+ ///  ,  CFFT_AlignedAlloc
+ /// </summary>
+ /// <param name="ptr">    ( NULL). </param>
+ void CFFT_AlignedFree(double *ptr)
+ {
+     if(ptr != NULL)
      {
-        for(i = 0; i < fftObj->N; ++i)
-        {
-            fftObj->FFT_P[i << 1] = ((fftObj->FFT_P[i << 1] << 1) +
-                                    ((i >> j) & 1));
-        }
+         free(((void **)ptr)[-1]);
      }
+ }
 
-     shift = (fftObj->FFT_P[2] == (fftObj->N >> 1)) ? 1 : 0;
-     for(i = 0; i < fftObj->NN; i += 2)
+ /// <summary>
+ ///   -   O(n):   i
+ ///       i / 2 -
+ /// bitrev(i) = (bitrev(i >> 1) >> 1) | ((i & 1) << (log2(n) - 1)).
+ ///     (re + im): P[2i] = 2 * bitrev(i),
+ /// P[2i + 1] = P[2i] + 1
+ /// </summary>
+ /// <param name="P">   (2n ). </param>
+ /// <param name="n">    ( ). </param>
+ void fill_BitReverse(int *P, int n)
+ {
+     int i, bits;
+
+     bits = Log2Int(n);
+
+     P[0] = 0;
+     P[1] = 1;
+
+     for(i = 1; i < n; ++i)
      {
-         fftObj->FFT_P[i + 1] = (fftObj->FFT_P[i + 0] <<= shift) + 1;
+         // P[i & ~1] = 2 * bitrev(i >> 1)
+         P[(i << 1) + 0] = ((P[i & ~1] >> 1) & ~1) | ((i & 1) << bits);
+         P[(i << 1) + 1] = P[(i << 1) + 0] + 1;
      }
  }
 
+ /// <summary>
+ ///        FFT
+ /// </summary>
+ /// <param name="fftObj">  FFT,    . </param>
+ void fill_FFT_P(CFFT_Object *fftObj)
+ {
+     //      FFT...
+     SAFE_DELETE(fftObj->FFT_P);
+     fftObj->FFT_P = (int *)calloc(fftObj->NN, sizeof(int));
+
+     //      ...
+     fill_BitReverse(fftObj->FFT_P, fftObj->N);
+ }
+
  /// <summary>
  ///        FFT
  /// (  FFT)
@@ -193,48 +308,105 @@
  /// <param name="fftObj">  FFT,    . </param>
  void fill_FFT_PP(CFFT_Object *fftObj)
  {
-     int i, j;
-     
      //      FFT...
      SAFE_DELETE(fftObj->FFT_PP);
      fftObj->FFT_PP = (int *)calloc(fftObj->NNPoly, sizeof(int));
 
-     //   ...
-     memset(fftObj->FFT_PP, 0x00, (fftObj->NNPoly * sizeof(int)));
-
      //      
      // (  FFT)...
-     for(j = 0; j < LogX(fftObj->NPoly, 2); ++j)
+     fill_BitReverse(fftObj->FFT_PP, fftObj->NPoly);
+ }
+
+ /// <summary>
+ ///        :  i 
+ /// bitrev(i)  i < bitrev(i) ( -   re + im). ,
+ ///    - ,    
+ /// </summary>
+ /// <param name="fftObj">  FFT,    . </param>
+ void fill_FFT_SW(CFFT_Object *fftObj)
+ {
+     int i, j, m;
+
+     //     
+     if(fftObj->FFT_P == NULL)
      {
-        for(i = 0; i < fftObj->NPoly; ++i)
-        {
-            fftObj->FFT_PP[i << 1] = ((fftObj->FFT_PP[i << 1] << 1) +
-                                     ((i >> j) & 1));
-        }
+         fill_FFT_P(fftObj);
      }
 
-     for(i = 0; i < fftObj->NNPoly; i += 2)
+     for(i = 0, m = 0; i < fftObj->N; ++i)
+     {
+         if(i < (fftObj->FFT_P[i << 1] >> 1))
+         {
+             ++m;
+         }
+     }
+
+     SAFE_DELETE(fftObj->FFT_SW);
+     fftObj->FFT_SW    = (int *)calloc((m << 1) + 1, sizeof(int));
+     fftObj->SwapCount = m;
+
+     for(i = 0, m = 0; i < fftObj->N; ++i)
      {
-         fftObj->FFT_PP[i + 1] = (fftObj->FFT_PP[i + 0] <<= 1) + 1;
+         j = fftObj->FFT_P[i << 1] >> 1;
+
+         if(i < j)
+         {
+             fftObj->FFT_SW[(m << 1) + 0] = i << 1;
+             fftObj->FFT_SW[(m << 1) + 1] = j << 1;
+             ++m;
+         }
      }
  }
 
  /// <summary>
- ///     
+ ///     (   
+ /// ).    ""   h 
+ /// ,     h: W[h + k] = exp(-+i * PI * k / h)
  /// </summary>
  /// <param name="fftObj">  FFT,    . </param>
- void fill_FFT_TW_Cosine(CFFT_Object *fftObj)
- {     
-     int i;
+ void fill_FFT_W(CFFT_Object *fftObj)
+ {
+     int h, k, idx;
+     double arg, wr, wi;
+
+     //      ...
+     SAFE_DELETE(fftObj->FFT_WD);
+     SAFE_DELETE(fftObj->FFT_WR);
+     fftObj->FFT_WD = (double *)calloc(fftObj->NN, sizeof(double));
+     fftObj->FFT_WR = (double *)calloc(fftObj->NN, sizeof(double));
+
+     //    (  
+     // ,     )...
+     for(h = 1; h < fftObj->N; h <<= 1)
+     {
+         for(k = 0; k < h; ++k)
+         {
+             arg = (M_PI * k) / (double)h;
+             wr  = cos(arg);
+             wi  = sin(arg);
+             idx = (h + k) << 1;
+
+             fftObj->FFT_WD[idx + 0] =  wr;
+             fftObj->FFT_WD[idx + 1] = -wi;
+             fftObj->FFT_WR[idx + 0] =  wr;
+             fftObj->FFT_WR[idx + 1] =  wi;
+         }
+     }
+ }
 
+ /// <summary>
+ ///    :
+ /// w(x) = (a0 - a1 * cos(x) + a2 * cos(2x) - a3 * cos(3x)) / ad
+ /// </summary>
+ /// <param name="cosTW">    . </param>
+ /// <param name="terms">  a0, a1, a2, a3, ad (5 ). </param>
+ void CFFT_CosineTerms(int cosTW, double *terms)
+ {
      //     
-     double arg, wval, a0, a1, a2, a3, ad;
-     
-     //     ...
-     fftObj->FFT_TW = (double *)calloc(fftObj->NN, sizeof(double));
+     double a0, a1, a2, a3, ad;
 
      //  : PS - "Peak Sidelobe" (  , )
-     switch (fftObj->CosTW)
+     switch (cosTW)
      {
         case RECTANGULAR_13dbPS:         { a0 = 1.0;       a1 = 0;         a2 = 0;         a3 = 0;         ad = 1.0;     break; }
         case HANN_31dbPS:                { a0 = 1.0;       a1 = 1.0;       a2 = 0;         a3 = 0;         ad = 2;       break; }
@@ -254,12 +426,55 @@
         case ROSENFIELD:                 { a0 = 0.762;     a1 = 1.0;       a2 = 0.238;     a3 = 0;         ad = a0;      break; }
      }
 
-     //    ...
-     for(i = 0; i < fftObj->N; ++i)
+     terms[0] = a0;
+     terms[1] = a1;
+     terms[2] = a2;
+     terms[3] = a3;
+     terms[4] = ad;
+ }
+
+ /// <summary>
+ ///     
+ /// </summary>
+ /// <param name="fftObj">  FFT,    . </param>
+ void fill_FFT_TW_Cosine(CFFT_Object *fftObj)
+ {     
+     int i, h;
+
+     //     
+     double c1, c2, c3, wval, a[5];
+     
+     //     ...
+     if(fftObj->FFT_TW == NULL)
+     {
+         fftObj->FFT_TW = (double *)calloc(fftObj->N, sizeof(double));
+     }
+
+     CFFT_CosineTerms(fftObj->CosTW, a);
+
+     //   (w[i] == w[N - i]) -  , 
+     //  . cos(arg)    
+     //   h = N / 2 (Re W[h + i] = cos(2 * PI * i / N)), 
+     //  -   : cos(2x) = 2cos^2(x) - 1,
+     // cos(3x) = 2cos(x)cos(2x) - cos(x)
+     h = fftObj->N >> 1;
+
+     for(i = 0; i <= h; ++i)
      {
-         arg  = (2.0 * M_PI * i) / (double)fftObj->N;
-         wval = (a0 - a1 * cos(arg) + a2 * cos(2 * arg) - a3 * cos(3 * arg)) / ad;
-         fftObj->FFT_TW[(i << 1) + 1] = fftObj->FFT_TW[(i << 1) + 0] = wval;
+         c1 = ((fftObj->FFT_WD != NULL) && (i < h)) ?
+              fftObj->FFT_WD[(h + i) << 1] :
+              cos((2.0 * M_PI * i) / (double)fftObj->N);
+         c2 = (2.0 * c1 * c1) - 1.0;
+         c3 = (2.0 * c1 * c2) - c1;
+
+         wval = (a[0] - a[1] * c1 + a[2] * c2 - a[3] * c3) / a[4];
+
+         fftObj->FFT_TW[i] = wval;
+
+         if((i > 0) && (i < h))
+         {
+             fftObj->FFT_TW[fftObj->N - i] = wval;
+         }
      }
  }
 
@@ -273,11 +488,8 @@
      double numerator, denominator, z, z1, z2, z3, z4, z5,
             z6, z7, z8, z9, z10, z11, z12, z13, z_1, z_2;
 
-     if(arg == 0.0)
-     {
-         return 1.0;
-     }
-     
+     //  arg == 0    (  
+     //   )
      z = arg * arg;
 
      z1  = z * 0.210580722890567e-22 + 0.380715242345326e-19;
@@ -303,702 +515,7379 @@
      return -numerator / denominator;
  }
 
+#ifdef SIMD_X86
+
+ /// <summary>
+ /// .       (SSE2,
+ ///    ;    )
+ /// </summary>
+ /// <param name="arg">  . </param>
+ /// <returns>  . </returns>
+ __m128d BesselI0_SSE2(__m128d arg)
+ {
+     __m128d z, p, q;
+
+     z = _mm_mul_pd(arg, arg);
+
+     p = _mm_add_pd(_mm_mul_pd(z, _mm_set1_pd(0.210580722890567e-22)), _mm_set1_pd(0.380715242345326e-19));
+     p = _mm_add_pd(_mm_mul_pd(z, p), _mm_set1_pd(0.479440257548300e-16));
+     p = _mm_add_pd(_mm_mul_pd(z, p), _mm_set1_pd(0.435125971262668e-13));
+     p = _mm_add_pd(_mm_mul_pd(z, p), _mm_set1_pd(0.300931127112960e-10));
+     p = _mm_add_pd(_mm_mul_pd(z, p), _mm_set1_pd(0.160224679395361e-7));
+     p = _mm_add_pd(_mm_mul_pd(z, p), _mm_set1_pd(0.654858370096785e-5));
+     p = _mm_add_pd(_mm_mul_pd(z, p), _mm_set1_pd(0.202591084143397e-2));
+     p = _mm_add_pd(_mm_mul_pd(z, p), _mm_set1_pd(0.463076284721000e0));
+     p = _mm_add_pd(_mm_mul_pd(z, p), _mm_set1_pd(0.754337328948189e2));
+     p = _mm_add_pd(_mm_mul_pd(z, p), _mm_set1_pd(0.830792541809429e4));
+     p = _mm_add_pd(_mm_mul_pd(z, p), _mm_set1_pd(0.571661130563785e6));
+     p = _mm_add_pd(_mm_mul_pd(z, p), _mm_set1_pd(0.216415572361227e8));
+     p = _mm_add_pd(_mm_mul_pd(z, p), _mm_set1_pd(0.356644482244025e9));
+     p = _mm_add_pd(_mm_mul_pd(z, p), _mm_set1_pd(0.144048298227235e10));
+
+     q = _mm_sub_pd(z, _mm_set1_pd(0.307646912682801e4));
+     q = _mm_add_pd(_mm_mul_pd(z, q), _mm_set1_pd(0.347626332405882e7));
+     q = _mm_sub_pd(_mm_mul_pd(z, q), _mm_set1_pd(0.144048298227235e10));
+
+     return _mm_div_pd(_mm_sub_pd(_mm_setzero_pd(), p), q);
+ }
+
+#endif
+
  /// <summary>
- ///     ( )
+ ///     ( ).   -
+ ///   ,  
  /// </summary>
  /// <param name="fftObj">  FFT,    . </param>
  void fill_FFT_TW_Kaiser(CFFT_Object *fftObj)
  {
-     int i, j;
-     double norm, arg, w;
+     int i, h;
+     double norm, scale, x, w;
+     double *TW;
 
-     //      FFT...
-     SAFE_DELETE(fftObj->FFT_TW);
-     fftObj->FFT_TW = (double *)calloc(fftObj->NN, sizeof(double));
+#ifdef SIMD_X86
+     __m128d vx, vw, vone, vbeta, vnorm;
+#endif
+
+     //     ...
+     if(fftObj->FFT_TW == NULL)
+     {
+         fftObj->FFT_TW = (double *)calloc(fftObj->N, sizeof(double));
+     }
+
+     TW = fftObj->FFT_TW;
+     h  = fftObj->N >> 1;
 
      //    
-     norm = BesselI0(fftObj->Beta);
+     norm  = BesselI0(fftObj->Beta);
+     scale = 2.0 / (double)(fftObj->N - 1);
+     i     = 0;
+
+     // w[i] = I0(Beta * sqrt(1 - x^2)) / I0(Beta), x = 2i / (N - 1) - 1;
+     // w[N - 1 - i] == w[i]
+
+#ifdef SIMD_X86
 
-     //   ...
-     for(i = 1; i <= (fftObj->N >> 1); ++i)
+     vone  = _mm_set1_pd(1.0);
+     vbeta = _mm_set1_pd(fftObj->Beta);
+     vnorm = _mm_set1_pd(norm);
+
+     for(; (i + 1) < h; i += 2)
      {
-         // arg = Beta * sqrt(1-(((2*(i-1))/(N-1))-1)^2);
-         arg = fftObj->Beta *
-                              sqrt(
-                                    1 - pow(
-                                             (
-                                                (double)((i - 1) << 1)
-                                              /
-                                                (double)(fftObj->N - 1)
-                                             ) - 1
-                                        , 2)
-                                   );
+         vx = _mm_sub_pd(_mm_set_pd((i + 1) * scale, i * scale), vone);
+         vx = _mm_mul_pd(vbeta, _mm_sqrt_pd(_mm_sub_pd(vone, _mm_mul_pd(vx, vx))));
+         vw = _mm_div_pd(BesselI0_SSE2(vx), vnorm);
+
+         _mm_storeu_pd(TW + i, vw);
+         _mm_storeu_pd(TW + (fftObj->N - 2) - i, _mm_shuffle_pd(vw, vw, 1));
+     }
+
+#endif
 
-         w = BesselI0(arg) / norm;
+     for(; i < h; ++i)
+     {
+         x = (i * scale) - 1.0;
+         w = BesselI0(fftObj->Beta * sqrt(1.0 - (x * x))) / norm;
 
-         j = i - 1; //     "1"   "0"
-         fftObj->FFT_TW[(j << 1) + 0] = w; // left re
-         fftObj->FFT_TW[(j << 1) + 1] = w; // left im
-         fftObj->FFT_TW[(fftObj->NN - 2) - (j << 1) + 0] = w; // right re
-         fftObj->FFT_TW[(fftObj->NN - 2) - (j << 1) + 1] = w; // right im
+         TW[i] = w;                   // left
+         TW[(fftObj->N - 1) - i] = w; // right
      }
  }
 
  /// <summary>
- /// ""  FFT
+ ///      " " (
+ ///   ).     -  
+ ///  
  /// </summary>
  /// <param name="fftObj">  FFT,    . </param>
- /// <returns>     FFT. </returns>
- int CFFT_Inspector(CFFT_Object *fftObj)
+ /// <param name="beta">    . </param>
+ /// <returns>   ( , beta )? </returns>
+ bool CFFT_SetBeta(CFFT_Object *fftObj, double beta)
  {
-     //       -!
-     if((fftObj->N     < MIN_FRAME_WIDTH) ||
-        (fftObj->NPoly < MIN_FRAME_WIDTH) ||
-        (fftObj->Beta  > MAX_KAISER_BETA))
+     if((fftObj->CosTW != NONE) || (beta < 0) || (beta > MAX_KAISER_BETA))
      {
          return FALSE;
      }
 
+     if((fftObj->Plan != NULL) && (fftObj->FFT_TW == fftObj->Plan->FFT_TW))
+     {
+         fftObj->FFT_TW = NULL;
+     }
+
+     fftObj->Beta = beta;
+     fill_FFT_TW_Kaiser(fftObj);
+
+     //       -   
+     //  
+     SAFE_DELETE(fftObj->FFT_TWR);
+     SAFE_DELETE(fftObj->FFT_TWS);
+
      return TRUE;
  }
 
  /// <summary>
- /// ""  FFT
+ ///    (   ).  
+ ///     -    ,
+ ///       
  /// </summary>
  /// <param name="fftObj">  FFT,    . </param>
- void CFFT_Destructor(CFFT_Object *fftObj)
+ /// <returns>    (N .). </returns>
+ double * CFFT_GetTWR(CFFT_Object *fftObj)
  {
-     SAFE_DELETE(fftObj->FFT_P);
-     SAFE_DELETE(fftObj->FFT_PP);
-     SAFE_DELETE(fftObj->FFT_TW);
-     SAFE_DELETE(fftObj);
+     int i;
+
+     if(fftObj->FFT_TWR == NULL)
+     {
+         fftObj->FFT_TWR = (double *)calloc(fftObj->N, sizeof(double));
+
+         for(i = 0; i < fftObj->N; ++i)
+         {
+             fftObj->FFT_TWR[i] = (fftObj->FFT_TW[i] == 0) ?
+                                  0 : (1.0 / fftObj->FFT_TW[i]);
+         }
+     }
+
+     return fftObj->FFT_TWR;
  }
 
  /// <summary>
- ///   FFT
+ ///    (   ): 
+ /// k + j * NPoly,    k,  
+ /// TW[k + j * NPoly] / ( TW^2  j) -   ,
+ ///    ,      NPoly
+ ///  (    N     )
  /// </summary>
- /// <param name="frameWidth">  . </param>
- /// <param name="cosTW">     (  -   ). </param>
- /// <param name="beta">    . </param>
- /// <param name="polyDiv2">     . </param>
- CFFT_Object * CFFT_Init(int frameWidth, int cosTW, double beta, int polyDiv2)
+ /// <param name="fftObj">  FFT,    . </param>
+ /// <returns>    (N .). </returns>
+ double * CFFT_GetTWS(CFFT_Object *fftObj)
  {
-     // -
-     CFFT_Object *fftObj = (CFFT_Object *)calloc(1, sizeof(CFFT_Object));
-
-     //   
-     fftObj->N = ToLowerPowerOf2(frameWidth);  //   FFT
-     fftObj->NN = fftObj->N << 1;              // -  (re + im)
-     fftObj->NPoly = fftObj->N >> polyDiv2;    //    FFT
-     fftObj->CosTW = cosTW;                    //    
-     fftObj->NNPoly = fftObj->NPoly << 1;      // -   FFT
-     fftObj->Beta = beta;                      // - .  
-     fftObj->PolyDiv = 1 << polyDiv2;          //  
+     int i, j, k;
+     double s;
 
-     fill_FFT_P(fftObj);  //    .   FFT
-     fill_FFT_PP(fftObj); //   ... (  FFT)
-     
-     if(fftObj->CosTW == NONE) //...      
+     if(fftObj->FFT_TWS == NULL)
      {
-         fill_FFT_TW_Kaiser(fftObj); //   
+         fftObj->FFT_TWS = (double *)calloc(fftObj->N, sizeof(double));
 
-     } else
-     {
-         fill_FFT_TW_Cosine(fftObj); //   
+         for(i = 0; i < fftObj->NPoly; ++i)
+         {
+             for(j = 0, s = 0; j < fftObj->PolyDiv; ++j)
+             {
+                 k  = i + (j * fftObj->NPoly);
+                 s += fftObj->FFT_TW[k] * fftObj->FFT_TW[k];
+             }
+
+             for(j = 0; j < fftObj->PolyDiv; ++j)
+             {
+                 k = i + (j * fftObj->NPoly);
+                 fftObj->FFT_TWS[k] = (s == 0) ? 0 : (fftObj->FFT_TW[k] / s);
+             }
+         }
      }
 
-     //     ...
+     return fftObj->FFT_TWS;
+ }
 
-#ifdef DUMP_MODE
+ /// <summary>
+ ///    DFT exp(+j * 2 * PI * k / N) (
+ ///   ):     
+ /// h = N / 2,   -     
+ /// </summary>
+ /// <param name="fftObj">  FFT,    . </param>
+ /// <returns>   (N  ). </returns>
+ double * CFFT_GetSDW(CFFT_Object *fftObj)
+ {
+     int k, h;
+     double wr, wi;
 
-     mkdir(DUMP_NAME);
+     if(fftObj->FFT_SDW == NULL)
+     {
+         fftObj->FFT_SDW = (double *)calloc(fftObj->NN, sizeof(double));
 
-     DumpInt(fftObj->FFT_P,     fftObj->NN,     DUMP_NAME, "FFT_P.int32");
-     DumpInt(fftObj->FFT_PP,    fftObj->NNPoly, DUMP_NAME, "FFT_PP.int32");
-     DumpDouble(fftObj->FFT_TW, fftObj->NN,     DUMP_NAME, "FFT_TW.double");
+         h = fftObj->N >> 1;
 
-#endif
+         for(k = 0; k < h; ++k)
+         {
+             if(fftObj->FFT_WD != NULL)
+             {
+                 wr =  fftObj->FFT_WD[((h + k) << 1) + 0];
+                 wi = -fftObj->FFT_WD[((h + k) << 1) + 1];
 
-     //      ...
-     if(!CFFT_Inspector(fftObj))
-     {
-         //...-  .
-         CFFT_Destructor(fftObj);
+             } else
+             {
+                 wr = cos(((M_2PI) * k) / (double)fftObj->N);
+                 wi = sin(((M_2PI) * k) / (double)fftObj->N);
+             }
+
+             fftObj->FFT_SDW[(k << 1) + 0] =  wr;
+             fftObj->FFT_SDW[(k << 1) + 1] =  wi;
+             fftObj->FFT_SDW[((h + k) << 1) + 0] = -wr;
+             fftObj->FFT_SDW[((h + k) << 1) + 1] = -wi;
+         }
      }
 
-     //   "FFT"
-     return fftObj;
+     return fftObj->FFT_SDW;
  }
 
  /// <summary>
- ///   FFT
+ ///  ""   2
  /// </summary>
- /// <param name="frameWidth">  . </param>
- /// <param name="cosTW">    . </param>
- /// <param name="polyDiv2">     . </param>
- CFFT_Object * CFFT_Constructor_Cosine(int frameWidth, int cosTW, int polyDiv2)
+ /// <param name="FFT_T">   (re + im). </param>
+ /// <param name="n">     . </param>
+ /// <param name="h">  ""  . </param>
+ /// <param name="W">    . </param>
+ /// <param name="k0">   ""  . </param>
+ /// <param name="k1">  ()  ""  . </param>
+ void CFFT_Radix2Stage(double *FFT_T, int n, int h, double *W,
+                       int k0, int k1)
  {
-     //   "FFT"
-     return CFFT_Init(frameWidth, cosTW, MAX_KAISER_BETA, polyDiv2);
- }
+     int i, j, k, istep;
+     double wr, wi, tempr, tempi;
 
- /// <summary>
- ///   FFT
- /// </summary>
- /// <param name="frameWidth">  . </param>
- /// <param name="beta">    . </param>
- /// <param name="polyDiv2">     . </param>
- CFFT_Object * CFFT_Constructor_Kaiser(int frameWidth, double beta, int polyDiv2)
- {
-     //   "FFT"
-     return CFFT_Init(frameWidth, NONE, beta, polyDiv2);
+     istep = h << 2; //    (  re + im)
+     n <<= 1;
+     h <<= 1;
+
+     for(k = (k0 << 1); k < (k1 << 1); k += 2)
+     {
+         wr = W[k + 0];
+         wi = W[k + 1];
+
+         for(i = k; i < n; i += istep)
+         {
+             j = i + h;
+             tempr = wr * FFT_T[j + 0] - wi * FFT_T[j + 1];
+             tempi = wi * FFT_T[j + 0] + wr * FFT_T[j + 1];
+             FFT_T[j + 0]  = FFT_T[i + 0] - tempr;
+             FFT_T[j + 1]  = FFT_T[i + 1] - tempi;
+             FFT_T[i + 0] += tempr;
+             FFT_T[i + 1] += tempi;
+         }
+     }
  }
 
  /// <summary>
- ///    FFT
+ ///  ""   4 (  radix-2
+ ///   h  2h)
  /// </summary>
- /// <param name="FFT_S">   
- /// (""  ""  - ./.). </param>
- /// <param name="FFT_S_Offset">     
- ///   FFT_S. </param>
- /// <param name="FFT_T">   . </param>
- /// <param name="useTaperWindow">   ? </param>
- /// <param name="recoverAfterTaperWindow">  
- ///     ? </param>
- /// <param name="useNorm">   1/N? </param>
+ /// <param name="FFT_T">   (re + im). </param>
+ /// <param name="n">     . </param>
+ /// <param name="h">     . </param>
+ /// <param name="W">   . </param>
  /// <param name="direction">   (TRUE - ).
  /// </param>
- /// <param name="usePolyphase">   FFT? </param>
- /// <param name="fftObj">  FFT,    . </param>
- void CFFT_Process(double *FFT_S, int FFT_S_Offset, double *FFT_T,
-                   bool useTaperWindow, bool recoverAfterTaperWindow,
-                   bool useNorm, bool direction, bool usePolyphase,
-                   CFFT_Object *fftObj)
+ /// <param name="k0">   ""  . </param>
+ /// <param name="k1">  ()  ""  . </param>
+ void CFFT_Radix4Stage(double *FFT_T, int n, int h, double *W, bool direction,
+                       int k0, int k1)
  {
-     int i, j, mmax, isteps, n, istep, ii, m, jj;
-     double isign, theta, sin05Th, wpr, wpi, wr, wi, tempr, tempi, wtemp;
-     
-     //    
-     //    
-     if(direction && useTaperWindow)
+     int i, k, k3, i1, i2, i3, istep;
+     double w1r, w1i, w2r, w2i, w3r, w3i, a1r, a1i, a2r, a2i, a3r, a3i,
+            t0r, t0i, t1r, t1i, t2r, t2i, t3r, t3i;
+
+     istep = h << 3; //    (  re + im)
+     n <<= 1;
+
+     for(k = k0; k < k1; ++k)
      {
-         if(!usePolyphase)
+         // w1 = W(4h)^k, w2 = W(2h)^k, w3 = W(4h)^3k
+         w1r = W[((h << 1) + k) << 1];
+         w1i = W[(((h << 1) + k) << 1) + 1];
+         w2r = W[(h + k) << 1];
+         w2i = W[((h + k) << 1) + 1];
+
+         // W(4h)^3k  3k >= 2h    : W(4h)^(3k - 2h)
+         k3 = 3 * k;
+         if(k3 < (h << 1))
          {
-             //  FFT
-             //  ,   
-             for(i = 0; i < fftObj->NN; ++i)
-             {
-                 FFT_T[i] = fftObj->FFT_TW[fftObj->FFT_P[i]] *
-                            FFT_S[fftObj->FFT_P[i] + FFT_S_Offset];
-             }
+             w3r = W[((h << 1) + k3) << 1];
+             w3i = W[(((h << 1) + k3) << 1) + 1];
+
+         } else
+         {
+             w3r = -W[k3 << 1];
+             w3i = -W[(k3 << 1) + 1];
          }
-         else
+
+         for(i = k << 1; i < n; i += istep)
          {
-             //  FFT
-             //      
-             for(i = 0; i < fftObj->NNPoly; ++i)
+             i1 = i  + (h << 1);
+             i2 = i1 + (h << 1);
+             i3 = i2 + (h << 1);
+
+             a1r = w2r * FFT_T[i1 + 0] - w2i * FFT_T[i1 + 1];
+             a1i = w2i * FFT_T[i1 + 0] + w2r * FFT_T[i1 + 1];
+             a2r = w1r * FFT_T[i2 + 0] - w1i * FFT_T[i2 + 1];
+             a2i = w1i * FFT_T[i2 + 0] + w1r * FFT_T[i2 + 1];
+             a3r = w3r * FFT_T[i3 + 0] - w3i * FFT_T[i3 + 1];
+             a3i = w3i * FFT_T[i3 + 0] + w3r * FFT_T[i3 + 1];
+
+             t0r = FFT_T[i + 0] + a1r;
+             t0i = FFT_T[i + 1] + a1i;
+             t1r = FFT_T[i + 0] - a1r;
+             t1i = FFT_T[i + 1] - a1i;
+             t2r = a2r + a3r;
+             t2i = a2i + a3i;
+
+             //    -i ( )  +i ()
+             if(direction)
              {
-                 FFT_T[i] = 0;
+                 t3r =  (a2i - a3i);
+                 t3i = -(a2r - a3r);
 
-                 //     ( 
-                 //   )
-                 for(j = 0; j < fftObj->PolyDiv; ++j)
-                 {
-                     FFT_T[i] += fftObj->FFT_TW[fftObj->FFT_PP[i] +
-                                 (j * fftObj->NNPoly)] * FFT_S[fftObj->FFT_PP[i] +
-                                 (j * fftObj->NNPoly) + FFT_S_Offset];
-                 }
+             } else
+             {
+                 t3r = -(a2i - a3i);
+                 t3i =  (a2r - a3r);
              }
+
+             FFT_T[i  + 0] = t0r + t2r;
+             FFT_T[i  + 1] = t0i + t2i;
+             FFT_T[i1 + 0] = t1r + t3r;
+             FFT_T[i1 + 1] = t1i + t3i;
+             FFT_T[i2 + 0] = t0r - t2r;
+             FFT_T[i2 + 1] = t0i - t2i;
+             FFT_T[i3 + 0] = t1r - t3r;
+             FFT_T[i3 + 1] = t1i - t3i;
          }
      }
-     else
-     {
-         //    ...
-         //    
-         for(i = 0; i < fftObj->NN; ++i)
-         {
-             FFT_T[i] = FFT_S[fftObj->FFT_P[i] + FFT_S_Offset];
-         }
-     }
+ }
 
-     //         
-     //    (   100% )
-     if((!direction) && (!useNorm))
+ /// <summary>
+ ///    FFT (  )
+ /// </summary>
+ /// <param name="FFT_T">   (re + im). </param>
+ /// <param name="FFT_S">   (  ). </param>
+ /// <param name="FFT_P">  . </param>
+ /// <param name="nn">   (re + im). </param>
+ void CFFT_Gather(double *FFT_T, double *FFT_S, int *FFT_P, int nn)
+ {
+     int i;
+
+     for(i = 0; i < nn; ++i)
      {
-         for(i = 0; i < fftObj->NNPoly; ++i)
-         {
-             FFT_T[i] /= fftObj->N;
-         }
+         FFT_T[i] = FFT_S[FFT_P[i]];
      }
+ }
 
-     // FFT Routine
-     isign  = direction ? -1 : 1;
-     mmax   = 2;
-     isteps = 1;
-     n = usePolyphase ? fftObj->NNPoly : fftObj->NN;
-     while(n > mmax)
-     {
-         isteps++;
-         istep   = mmax << 1;
-         theta   = isign * ((2 * M_PI) / mmax);
-         sin05Th = sin(0.5 * theta);
-         wpr = -(2.0 * (sin05Th * sin05Th));
-         wpi = sin(theta);
-         wr  = 1.0;
-         wi  = 0.0;
+ /// <summary>
+ ///    FFT    
+ /// </summary>
+ /// <param name="FFT_T">   (re + im). </param>
+ /// <param name="FFT_S">   (  ). </param>
+ /// <param name="FFT_P">  . </param>
+ /// <param name="FFT_TW">   (  ). </param>
+ /// <param name="nn">   (re + im). </param>
+ void CFFT_GatherTW(double *FFT_T, double *FFT_S, int *FFT_P, double *FFT_TW,
+                    int nn)
+ {
+     int i;
 
-         for(ii = 1; ii <= (mmax >> 1); ++ii)
-         {
-             m = (ii << 1) - 1;
-             for(jj = 0; jj <= ((n - m) >> isteps); ++jj)
-             {
-                 i = m + (jj << isteps);
-                 j = i + mmax;
-                 tempr = wr * FFT_T[j - 1] - wi * FFT_T[j];
-                 tempi = wi * FFT_T[j - 1] + wr * FFT_T[j];
-                 FFT_T[j - 1]  = FFT_T[i - 1] - tempr;
-                 FFT_T[j - 0]  = FFT_T[i - 0] - tempi;
-                 FFT_T[i - 1] += tempr;
-                 FFT_T[i - 0] += tempi;
-             }
-             wtemp = wr;
-             wr = wr * wpr - wi    * wpi + wr;
-             wi = wi * wpr + wtemp * wpi + wi;
-         }
-         mmax = istep;
+     for(i = 0; i < nn; ++i)
+     {
+         FFT_T[i] = FFT_TW[FFT_P[i] >> 1] * FFT_S[FFT_P[i]];
      }
+ }
 
-     //        
-     //     (   100% )
-     if(direction && useNorm)
+ /// <summary>
+ ///    : FFT_T[i] (+)= FFT_TW[i / 2] * FFT_S[i]
+ /// (     - )
+ /// </summary>
+ /// <param name="FFT_T">    (re + im). </param>
+ /// <param name="FFT_S">   . </param>
+ /// <param name="FFT_TW">   , 
+ ///  . </param>
+ /// <param name="nn">   (re + im). </param>
+ /// <param name="accumulate">   (FALSE -  ,
+ ///  )? </param>
+ void CFFT_FoldTW(double *FFT_T, double *FFT_S, double *FFT_TW, int nn,
+                  bool accumulate)
+ {
+     int i;
+
+     if(accumulate)
      {
-         for(i = 0; i < n; ++i)
+         for(i = 0; i < nn; ++i)
          {
-             FFT_T[i] /= fftObj->N;
+             FFT_T[i] += FFT_TW[i >> 1] * FFT_S[i];
          }
-     }
 
-     //    (      
-     // -        )
-     if((!direction) && useTaperWindow && recoverAfterTaperWindow)
+     } else
      {
-         for(i = 0; i < fftObj->NN; ++i)
+         for(i = 0; i < nn; ++i)
          {
-             FFT_T[i] = ((fftObj->FFT_TW[i] == 0) ?
-                        0 : (FFT_T[i] / fftObj->FFT_TW[i]));
+             FFT_T[i] = FFT_TW[i >> 1] * FFT_S[i];
          }
      }
  }
 
  /// <summary>
- ///  ""  "" : ("" -
- ///    , "" -  )
+ ///   ()
  /// </summary>
- /// <param name="FFT_T">   . </param>
- /// <param name="MagL">  "" . </param>
- /// <param name="MagR">  "" . </param>
- /// <param name="ACH">  (  ""   
- /// "" -  "" / ""). </param>
- /// <param name="ArgL">  "" . </param>
- /// <param name="ArgR">  "" . </param>
- /// <param name="PhaseLR">     ("" 
- /// ""). </param>
- /// <param name="usePolyphase">   FFT? </param>
- /// <param name="fftObj">  FFT,    . </param>
- void CFFT_Explore(double *FFT_T, double *MagL, double *MagR, double *ACH,
-                   double *ArgL, double *ArgR, double *PhaseLR, bool usePolyphase,
-                   CFFT_Object *fftObj)
+ /// <param name="FFT_T">  . </param>
+ /// <param name="nn">  . </param>
+ /// <param name="mult"> . </param>
+ void CFFT_Scale(double *FFT_T, int nn, double mult)
  {
-     int N, i;
-     double magL, magR, FFT_T_i_Re, FFT_T_i_Im, FFT_T_N_i_Re, FFT_T_N_i_Im,
-            lx, ly, rx, ry, argL, argR;
-
-     //   FFT
-     N = usePolyphase ? fftObj->NPoly : fftObj->N;
-
-     //       
-     // ("" )
-     magL = FFT_T[0];
-     magR = FFT_T[1];
-          
-     if(MagL    != NULL) MagL[0]    = magL;
-     if(MagR    != NULL) MagR[0]    = magR;
-     if(ACH     != NULL) ACH[0]     = magR / ((magL == 0) ? FLOAT_MIN : magL);
-     if(ArgL    != NULL) ArgL[0]    = M_PI;
-     if(ArgR    != NULL) ArgR[0]    = M_PI;
-     if(PhaseLR != NULL) PhaseLR[0] = 0;
+     int i;
 
-     //    
-     for(i = 1; i < (N >> 1); ++i)
+     for(i = 0; i < nn; ++i)
      {
-         FFT_T_i_Re   = FFT_T[(i << 1) + 0];
-         FFT_T_i_Im   = FFT_T[(i << 1) + 1];
-         FFT_T_N_i_Re = FFT_T[((N - i) << 1) + 0];
-         FFT_T_N_i_Im = FFT_T[((N - i) << 1) + 1];
-
-         lx = FFT_T_i_Re   + FFT_T_N_i_Re;
-         ly = FFT_T_i_Im   - FFT_T_N_i_Im;
-         rx = FFT_T_i_Im   + FFT_T_N_i_Im;
-         ry = FFT_T_N_i_Re - FFT_T_i_Re;
+         FFT_T[i] *= mult;
+     }
+ }
 
-         magL = sqrt((lx * lx) + (ly * ly)) * 0.5;
-         magR = sqrt((rx * rx) + (ry * ry)) * 0.5;
-         argL = Safe_atan2(ly, lx);
-         argR = Safe_atan2(ry, rx);
+ /// <summary>
+ ///    :    
+ /// </summary>
+ /// <param name="FFT_T">   (re + im). </param>
+ /// <param name="FFT_TWR">   . </param>
+ /// <param name="nn">   (re + im). </param>
+ void CFFT_ScaleTW(double *FFT_T, double *FFT_TWR, int nn)
+ {
+     int i;
 
-         if(MagL    != NULL) MagL[i] = magL;
-         if(MagR    != NULL) MagR[i] = magR;
-         if(ACH     != NULL) ACH[i]  = magR / ((magL == 0) ? FLOAT_MIN : magL);
-         if(ArgL    != NULL) ArgL[i] = argL;
-         if(ArgR    != NULL) ArgR[i] = argR;
-         if(PhaseLR != NULL) PhaseLR[i] = PhaseNorm(argR - argL);
+     for(i = 0; i < nn; i += 2)
+     {
+         FFT_T[i + 0] *= FFT_TWR[i >> 1];
+         FFT_T[i + 1] *= FFT_TWR[i >> 1];
      }
  }
 
  /// <summary>
- ///    FFT ( CFFT  MathCAD)
+ ///    DFT  count ;   
+ /// X[k] = (X[k] - x_old + x_new) * exp(+j * 2 * PI * k / N)
  /// </summary>
- /// <param name="FFT_T">   . </param>
- /// <param name="Mag"> . </param>
- /// <param name="Arg"> . </param>
- /// <param name="usePolyphase">   FFT? </param
- /// <param name="isMirror">   ? </param>
- /// <param name="fftObj">  FFT,    . </param>
- void CFFT_ComplexExplore(double *FFT_T, double *Mag, double *Arg,
-                          bool usePolyphase, bool isMirror,
-                          CFFT_Object *fftObj)
+ /// <param name="FFT_SD">   DFT (re + im). </param>
+ /// <param name="FFT_SDW">   (CFFT_GetSDW). </param>
+ /// <param name="FFT_Old"> ,   (re + im). </param>
+ /// <param name="FFT_New"> ,    (re + im). </param>
+ /// <param name="count"> -  . </param>
+ /// <param name="nn">    (re + im). </param>
+ void CFFT_SlideDFT(double *FFT_SD, double *FFT_SDW, double *FFT_Old,
+                    double *FFT_New, int count, int nn)
  {
-     int N, N_2, i;
-     double magL, magR, FFT_T_i_Re, FFT_T_i_Im, FFT_T_N_i_Re, FFT_T_N_i_Im,
-            lx, ly, rx, ry, argL, argR;
-
-     //   FFT
-     N   = usePolyphase ? fftObj->NPoly : fftObj->N;
-     N_2 = N >> 1;
+     int i, k;
+     double dr, di, xr, xi;
 
-     //       
-     // ("" )
-     lx = FFT_T[0];
-     ly = FFT_T[1];
-     rx = FFT_T[N + 0];
-     ry = FFT_T[N + 1];
-     
-     if(Mag != NULL)
+     for(i = 0; i < (count << 1); i += 2)
      {
-         magL = sqrt((lx * lx) + (ly * ly));
-         magR = sqrt((rx * rx) + (ry * ry));
+         dr = FFT_New[i + 0] - FFT_Old[i + 0];
+         di = FFT_New[i + 1] - FFT_Old[i + 1];
 
-         if(!isMirror)
+         for(k = 0; k < nn; k += 2)
          {
-            Mag[0]   = magL;
-            Mag[N_2] = magR;
+             xr = FFT_SD[k + 0] + dr;
+             xi = FFT_SD[k + 1] + di;
 
-         } else
-         {
-            Mag[N_2 - 1] = magL;
-            Mag[N   - 1] = magR;
+             FFT_SD[k + 0] = (xr * FFT_SDW[k + 0]) - (xi * FFT_SDW[k + 1]);
+             FFT_SD[k + 1] = (xr * FFT_SDW[k + 1]) + (xi * FFT_SDW[k + 0]);
          }
      }
+ }
 
-     if(Arg != NULL)
+ /// <summary>
+ ///      :  
+ ///    
+ /// FFT_T[k] = c[0] * X[k] +   m = 1..3 c[m] * (X[k - m] + X[k + m])
+ /// </summary>
+ /// <param name="FFT_T">    (re + im). </param>
+ /// <param name="FFT_SD">   DFT (re + im). </param>
+ /// <param name="c">   (4 .). </param>
+ /// <param name="nn">    (re + im). </param>
+ /// <param name="a">   . </param>
+ /// <param name="b"> ,     . </param>
+ void CFFT_SlideTW(double *FFT_T, double *FFT_SD, double *c, int nn,
+                   int a, int b)
+ {
+     int k, m, lo, hi;
+     double re, im;
+
+     for(k = a; k < b; k += 2)
      {
-         argL = Safe_atan2(ly, lx);
-         argR = Safe_atan2(ry, rx);
-         
-         if(!isMirror)
-         {
-            Arg[0]   = argL;
-            Arg[N_2] = argR;
+         re = c[0] * FFT_SD[k + 0];
+         im = c[0] * FFT_SD[k + 1];
 
-         } else
+         for(m = 1; m <= 3; ++m)
          {
-            Arg[N_2 - 1] = argL;
-            Arg[N   - 1] = argR;
+             lo  = (k - (m << 1)) & (nn - 1);
+             hi  = (k + (m << 1)) & (nn - 1);
+             re += c[m] * (FFT_SD[lo + 0] + FFT_SD[hi + 0]);
+             im += c[m] * (FFT_SD[lo + 1] + FFT_SD[hi + 1]);
          }
-     }
 
-     //    
-     for(i = 1; i < N_2; ++i)
-     {
-         FFT_T_i_Re   = FFT_T[(i << 1) + 0];
-         FFT_T_i_Im   = FFT_T[(i << 1) + 1];
-         FFT_T_N_i_Re = FFT_T[((N - i) << 1) + 0];
-         FFT_T_N_i_Im = FFT_T[((N - i) << 1) + 1];
+         FFT_T[k + 0] = re;
+         FFT_T[k + 1] = im;
+     }
+ }
 
-         lx = FFT_T_i_Re;
-         ly = FFT_T_i_Im;
-         rx = FFT_T_N_i_Re;
-         ry = FFT_T_N_i_Im;
+ /// <summary>
+ ///    GOERTZEL_LANES     
+ ///   .    ( 
+ ///  ): d = d + lambda * s + x, s = d + s, 
+ /// lambda = -4 * sin^2(w / 2).   cos(w) < 0  
+ ///  w - PI     
+ /// (sign = -1),       
+ /// </summary>
+ /// <param name="FFT_S">    (""  ""
+ ///  - ./.). </param>
+ /// <param name="FFT_TW">   (NULL -  ). </param>
+ /// <param name="n">    (). </param>
+ /// <param name="sign">       
+ ///  (GOERTZEL_LANES  +1 / -1). </param>
+ /// <param name="lambda">    (GOERTZEL_LANES
+ /// ). </param>
+ /// <param name="state">  : (d, s) ""  ""
+ ///  - dL, dR, sL, sR   . </param>
+ void CFFT_Goertzel(double *FFT_S, double *FFT_TW, int n, double *sign,
+                    double *lambda, double *state)
+ {
+     int i, b, c;
+     double x[2], d[GOERTZEL_LANES << 1], s[GOERTZEL_LANES << 1];
 
-         if(Mag != NULL)
-         {
-             magL = sqrt((lx * lx) + (ly * ly));
-             magR = sqrt((rx * rx) + (ry * ry));
+     memset(d, 0, sizeof(d));
+     memset(s, 0, sizeof(s));
 
-             if(!isMirror)
-             {
-                Mag[i]     = magL;
-                Mag[N - i] = magR;
+     for(i = 0; i < n; ++i)
+     {
+         x[0] = FFT_S[(i << 1) + 0];
+         x[1] = FFT_S[(i << 1) + 1];
 
-             } else
-             {
-                Mag[N_2 - i - 1] = magL;
-                Mag[N_2 + i - 1] = magR;
-             }
+         if(FFT_TW != NULL)
+         {
+             x[0] *= FFT_TW[i];
+             x[1] *= FFT_TW[i];
          }
 
-         if(Arg != NULL)
+         for(b = 0; b < GOERTZEL_LANES; ++b)
          {
-             argL = Safe_atan2(ly, lx);
-             argR = Safe_atan2(ry, rx);
-             
-             if(!isMirror)
-             {
-                Arg[i]     = argL;
-                Arg[N - i] = argR;
-
-             } else
+             for(c = 0; c < 2; ++c)
              {
-                Arg[N_2 - i - 1] = argL;
-                Arg[N_2 + i - 1] = argR;
+                 d[(b << 1) + c] += (lambda[b] * s[(b << 1) + c]) +
+                                    ((i & 1) ? (sign[b] * x[c]) : x[c]);
+                 s[(b << 1) + c] += d[(b << 1) + c];
              }
          }
      }
+
+     for(b = 0; b < GOERTZEL_LANES; ++b)
+     {
+         state[(b << 2) + 0] = d[(b << 1) + 0];
+         state[(b << 2) + 1] = d[(b << 1) + 1];
+         state[(b << 2) + 2] = s[(b << 1) + 0];
+         state[(b << 2) + 3] = s[(b << 1) + 1];
+     }
  }
 
  /// <summary>
- ///    double   dB
+ ///    
  /// </summary>
- /// <param name="data">   . </param>
- /// <param name="zero_db_level">  "" . </param>
- /// <param name="fftObj">  FFT,    . </param>
- void dB_Scale(double *data, double zero_db_level,
-               CFFT_Object *fftObj)
+ /// <param name="Z">   (re + im). </param>
+ /// <param name="n">   . </param>
+ /// <param name="Mag"> . </param>
+ void CFFT_Magnitude(double *Z, int n, double *Mag)
  {
      int i;
-     for(i = 0; i < fftObj->N >> 1; ++i)
+
+     for(i = 0; i < n; ++i)
      {
-         data[i] = 10 * log10(data[i] / zero_db_level); // log
+         Mag[i] = sqrt((Z[(i << 1) + 0] * Z[(i << 1) + 0]) +
+                       (Z[(i << 1) + 1] * Z[(i << 1) + 1]));
      }
  }
 
  /// <summary>
- ///      -
- ///    
+ ///     (atan2   )
  /// </summary>
- /// <param name="FFT_S">    (""  "" 
- /// - ./.) </param>
- /// <param name="ACH_Difference">    
- ///      . </param>
- /// <param name="fftObj">  FFT,    . </param>
- /// <returns>  "   
- /// -   ". </returns>
- CFFT_SelfTestResult SelfTest_S(double *FFT_S, double ACH_Difference,
-                                CFFT_Object *fftObj)
+ /// <param name="Z">   (re + im). </param>
+ /// <param name="n">   . </param>
+ /// <param name="Arg"> . </param>
+ void CFFT_Argument(double *Z, int n, double *Arg)
  {
-     double *FFT_S_backward, *FFT_T, *MagL, *MagR, *ACH, *ArgL, *ArgR, *PhaseLR;
-     int N2, FFT_S_Offset, i;
-     bool useTaperWindow, recoverAfterTaperWindow, useNorm, direction,
-          usePolyphase;
-     double maxDiff, FFT_T_i_Re, FFT_T_i_Im, FFT_T_N_i_Re, FFT_T_N_i_Im,
-            lx, ly, rx, ry, lx_, ly_, rx_, ry_, currentDiff;
-     LARGE_INTEGER startCounter, CFFT_Process_counter, CFFT_Explore_counter, timerFrequency;
-     int N_iters = 10000;
+     int i;
 
-     // C "   
-     // -   "
-     CFFT_SelfTestResult selfTestResult;
+     for(i = 0; i < n; ++i)
+     {
+         Arg[i] = Safe_atan2(Z[(i << 1) + 1], Z[(i << 1) + 0]);
+     }
+ }
 
-     //    -      FFT
-     FFT_S_backward = (double *)calloc(fftObj->NN, sizeof(double));
+ /// <summary>
+ ///     ( )
+ /// </summary>
+ void CFFT_ArgumentFast(double *Z, int n, double *Arg)
+ {
+     int i;
 
-     //  
-     FFT_T = (double *)calloc(fftObj->NN, sizeof(double));
+     for(i = 0; i < n; ++i)
+     {
+         Arg[i] = Fast_atan2(Z[(i << 1) + 1], Z[(i << 1) + 0]);
+     }
+ }
 
-     // (  FFT / 2) -     
-     N2 = fftObj->N >> 1;
+ /// <summary>
+ ///        ( )
+ /// </summary>
+ /// <param name="FFT_T">   (re + im). </param>
+ /// <param name="FFT_SW">   . </param>
+ /// <param name="count"> -  . </param>
+ void CFFT_SwapPairs(double *FFT_T, int *FFT_SW, int count)
+ {
+     int m, a, b;
+     double re, im;
 
-     //   -
-     MagL    = (double *)calloc(N2, sizeof(double));
-     MagR    = (double *)calloc(N2, sizeof(double));
-     ACH     = (double *)calloc(N2, sizeof(double));
-     ArgL    = (double *)calloc(N2, sizeof(double));
-     ArgR    = (double *)calloc(N2, sizeof(double));
-     PhaseLR = (double *)calloc(N2, sizeof(double));
+     for(m = 0; m < (count << 1); m += 2)
+     {
+         a = FFT_SW[m + 0];
+         b = FFT_SW[m + 1];
+         re = FFT_T[a + 0];
+         im = FFT_T[a + 1];
+         FFT_T[a + 0] = FFT_T[b + 0];
+         FFT_T[a + 1] = FFT_T[b + 1];
+         FFT_T[b + 0] = re;
+         FFT_T[b + 1] = im;
+     }
+ }
 
-     //    ,  
+ /// <summary>
+ ///       FFT_P / FFT_PP
+ /// (  i  bitrev(i)  i < bitrev(i))
+ /// </summary>
+ /// <param name="FFT_T">   (re + im). </param>
+ /// <param name="FFT_P">  . </param>
+ /// <param name="nn">   (re + im). </param>
+ void CFFT_SwapByTable(double *FFT_T, int *FFT_P, int nn)
+ {
+     int i, j;
+     double re, im;
+
+     for(i = 0; i < nn; i += 2)
+     {
+         j = FFT_P[i];
+
+         if(i < j)
+         {
+             re = FFT_T[i + 0];
+             im = FFT_T[i + 1];
+             FFT_T[i + 0] = FFT_T[j + 0];
+             FFT_T[i + 1] = FFT_T[j + 1];
+             FFT_T[j + 0] = re;
+             FFT_T[j + 1] = im;
+         }
+     }
+ }
+
+ /// <summary>
+ /// -      ( , 
+ ///       FFT)
+ /// </summary>
+ /// <param name="FFT_T">   (re + im). </param>
+ /// <param name="n">     . </param>
+ void CFFT_BitReverse(double *FFT_T, int n)
+ {
+     int i, j, k;
+     double re, im;
+
+     for(i = 0, j = 0; i < (n - 1); ++i)
+     {
+         if(i < j)
+         {
+             re = FFT_T[(i << 1) + 0];
+             im = FFT_T[(i << 1) + 1];
+             FFT_T[(i << 1) + 0] = FFT_T[(j << 1) + 0];
+             FFT_T[(i << 1) + 1] = FFT_T[(j << 1) + 1];
+             FFT_T[(j << 1) + 0] = re;
+             FFT_T[(j << 1) + 1] = im;
+         }
+
+         // -  j
+         for(k = n >> 1; k <= j; k >>= 1)
+         {
+             j -= k;
+         }
+
+         j += k;
+     }
+ }
+
+#ifdef SIMD_X86
+
+ //---------------------------------------------------------------------------
+ // SIMD-.   " " (re, im),   
+ // SSE2 / AVX2 / AVX-512  1 / 2 / 4  . 
+ //    (  ). 
+ // "" [k0, k1)    -   .
+ //---------------------------------------------------------------------------
+
+#if defined(_MSC_VER)
+ #include <intrin.h>
+ #define SIMD_TARGET(isa)
+#else
+ #include <cpuid.h>
+ #define SIMD_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+ //   b * w (SSE2, neg = { -0.0, 0.0 })
+ #define SSE2_CMUL(b, w, neg) \
+         _mm_add_pd(_mm_mul_pd((b), _mm_unpacklo_pd((w), (w))), \
+                    _mm_xor_pd(_mm_mul_pd(_mm_shuffle_pd((b), (b), 1), \
+                                          _mm_unpackhi_pd((w), (w))), (neg)))
+
+ //   b * w (AVX2 + FMA)
+ #define AVX2_CMUL(b, w) \
+         _mm256_fmaddsub_pd((b), _mm256_movedup_pd(w), \
+                            _mm256_mul_pd(_mm256_permute_pd((b), 0x5), \
+                                          _mm256_permute_pd((w), 0xF)))
+
+ //   b * w (AVX-512F)
+ #define AVX512_CMUL(b, w) \
+         _mm512_fmaddsub_pd((b), _mm512_movedup_pd(w), \
+                            _mm512_mul_pd(_mm512_permute_pd((b), 0x55), \
+                                          _mm512_permute_pd((w), 0xFF)))
+
+ /// <summary>
+ ///   CPUID
+ /// </summary>
+ /// <param name="leaf">   CPUID. </param>
+ /// <param name="subleaf">   CPUID. </param>
+ /// <param name="regs"> : EAX, EBX, ECX, EDX. </param>
+ void CFFT_CpuId(int leaf, int subleaf, unsigned int regs[4])
+ {
+#if defined(_MSC_VER)
+     int info[4];
+     __cpuidex(info, leaf, subleaf);
+     regs[0] = info[0]; regs[1] = info[1]; regs[2] = info[2]; regs[3] = info[3];
+#else
+     regs[0] = regs[1] = regs[2] = regs[3] = 0;
+     if((unsigned int)leaf <= __get_cpuid_max(0, NULL))
+     {
+         __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+     }
+#endif
+ }
+
+ /// <summary>
+ ///   XCR0 (,     )
+ /// </summary>
+ unsigned int CFFT_XCR0(void)
+ {
+#if defined(_MSC_VER)
+     return (unsigned int)_xgetbv(0);
+#else
+     unsigned int eax, edx;
+     __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+     return eax;
+#endif
+ }
+
+ /// <summary>
+ ///    SIMD,    
+ /// </summary>
+ /// <returns>  SIMD (SIMD_NONE ... SIMD_AVX512). </returns>
+ int CFFT_DetectSIMD(void)
+ {
+     unsigned int regs1[4], regs7[4], xcr0;
+     int level = SIMD_NONE;
+
+     CFFT_CpuId(1, 0, regs1);
+     CFFT_CpuId(7, 0, regs7);
+
+     // SSE2: EDX.26
+     if(regs1[3] & (1 << 26))
+     {
+         level = SIMD_SSE2;
+     }
+
+     // AVX2 + FMA:    (OSXSAVE, ECX.27; XCR0: XMM + YMM)
+     if((level == SIMD_SSE2) && (regs1[2] & (1 << 27)))
+     {
+         xcr0 = CFFT_XCR0();
+
+#ifdef SIMD_X86_AVX2
+         if(((xcr0 & 0x06) == 0x06) &&
+            (regs1[2] & (1 << 28)) && // AVX
+            (regs1[2] & (1 << 12)) && // FMA
+            (regs7[1] & (1 << 5)))    // AVX2
+         {
+             level = SIMD_AVX2;
+         }
+#endif
+
+#ifdef SIMD_X86_AVX512
+         // AVX-512F: EBX.16 ( 7); XCR0: + opmask, ZMM
+         if((level == SIMD_AVX2) &&
+            ((xcr0 & 0xE6) == 0xE6) &&
+            (regs7[1] & (1 << 16)))
+         {
+             level = SIMD_AVX512;
+         }
+#endif
+     }
+
+     return level;
+ }
+
+ /// <summary>
+ ///  ""   2 (SSE2)
+ /// </summary>
+ SIMD_TARGET("sse2")
+ void CFFT_Radix2Stage_SSE2(double *FFT_T, int n, int h, double *W,
+                            int k0, int k1)
+ {
+     int g, k;
+     double *a, *b;
+     __m128d neg, w, x0, x1, t;
+
+     neg = _mm_set_pd(0.0, -0.0);
+     n <<= 1;
+     h <<= 1;
+
+     for(g = 0; g < n; g += (h << 1))
+     {
+         a = FFT_T + g;
+         b = a + h;
+
+         for(k = (k0 << 1); k < (k1 << 1); k += 2)
+         {
+             w  = _mm_loadu_pd(W + k);
+             x0 = _mm_loadu_pd(a + k);
+             x1 = _mm_loadu_pd(b + k);
+             t  = SSE2_CMUL(x1, w, neg);
+             _mm_storeu_pd(a + k, _mm_add_pd(x0, t));
+             _mm_storeu_pd(b + k, _mm_sub_pd(x0, t));
+         }
+     }
+ }
+
+ /// <summary>
+ ///  ""   4 (SSE2)
+ /// </summary>
+ SIMD_TARGET("sse2")
+ void CFFT_Radix4Stage_SSE2(double *FFT_T, int n, int h, double *W,
+                            bool direction, int k0, int k1)
+ {
+     int i, k, hh;
+     double *x;
+     __m128d neg, rot, w1, w2, w3, x0, a1, a2, a3, t0, t1, t2, t3;
+
+     neg = _mm_set_pd(0.0, -0.0);
+
+     //   -i: (re, im) -> (im, -re);  +i: (re, im) -> (-im, re)
+     rot = direction ? _mm_set_pd(-0.0, 0.0) : _mm_set_pd(0.0, -0.0);
+     hh  = h << 1;
+     n <<= 1;
+
+     for(k = (k0 << 1); k < (k1 << 1); k += 2)
+     {
+         w1 = _mm_loadu_pd(W + (hh << 1) + k);
+         w2 = _mm_loadu_pd(W + hh + k);
+         w3 = SSE2_CMUL(w1, w2, neg);
+
+         for(i = k; i < n; i += (hh << 2))
+         {
+             x  = FFT_T + i;
+             x0 = _mm_loadu_pd(x);
+             a1 = _mm_loadu_pd(x + hh);
+             a2 = _mm_loadu_pd(x + (hh << 1));
+             a3 = _mm_loadu_pd(x + (hh << 1) + hh);
+             a1 = SSE2_CMUL(a1, w2, neg);
+             a2 = SSE2_CMUL(a2, w1, neg);
+             a3 = SSE2_CMUL(a3, w3, neg);
+
+             t0 = _mm_add_pd(x0, a1);
+             t1 = _mm_sub_pd(x0, a1);
+             t2 = _mm_add_pd(a2, a3);
+             t3 = _mm_sub_pd(a2, a3);
+             t3 = _mm_xor_pd(_mm_shuffle_pd(t3, t3, 1), rot);
+
+             _mm_storeu_pd(x,                   _mm_add_pd(t0, t2));
+             _mm_storeu_pd(x + hh,              _mm_add_pd(t1, t3));
+             _mm_storeu_pd(x + (hh << 1),       _mm_sub_pd(t0, t2));
+             _mm_storeu_pd(x + (hh << 1) + hh,  _mm_sub_pd(t1, t3));
+         }
+     }
+ }
+
+ /// <summary>
+ ///    FFT (SSE2).  (re, im)  
+ ///   128- : FFT_P[2k + 1] == FFT_P[2k] + 1
+ /// </summary>
+ SIMD_TARGET("sse2")
+ void CFFT_Gather_SSE2(double *FFT_T, double *FFT_S, int *FFT_P, int nn)
+ {
+     int i;
+
+     for(i = 0; i < nn; i += 2)
+     {
+         _mm_storeu_pd(FFT_T + i, _mm_loadu_pd(FFT_S + FFT_P[i]));
+     }
+ }
+
+ /// <summary>
+ ///    FFT     (SSE2)
+ /// </summary>
+ SIMD_TARGET("sse2")
+ void CFFT_GatherTW_SSE2(double *FFT_T, double *FFT_S, int *FFT_P,
+                         double *FFT_TW, int nn)
+ {
+     int i, p;
+
+     for(i = 0; i < nn; i += 2)
+     {
+         p = FFT_P[i];
+         _mm_storeu_pd(FFT_T + i, _mm_mul_pd(_mm_load1_pd(FFT_TW + (p >> 1)),
+                                             _mm_loadu_pd(FFT_S  + p)));
+     }
+ }
+
+ /// <summary>
+ ///     (SSE2)
+ /// </summary>
+ SIMD_TARGET("sse2")
+ void CFFT_FoldTW_SSE2(double *FFT_T, double *FFT_S, double *FFT_TW, int nn,
+                       bool accumulate)
+ {
+     int i;
+
+     if(accumulate)
+     {
+         for(i = 0; i < nn; i += 2)
+         {
+             _mm_storeu_pd(FFT_T + i, _mm_add_pd(_mm_loadu_pd(FFT_T + i),
+                                      _mm_mul_pd(_mm_load1_pd(FFT_TW + (i >> 1)),
+                                                 _mm_loadu_pd(FFT_S  + i))));
+         }
+
+     } else
+     {
+         for(i = 0; i < nn; i += 2)
+         {
+             _mm_storeu_pd(FFT_T + i, _mm_mul_pd(_mm_load1_pd(FFT_TW + (i >> 1)),
+                                                 _mm_loadu_pd(FFT_S  + i)));
+         }
+     }
+ }
+
+ /// <summary>
+ ///   (SSE2)
+ /// </summary>
+ SIMD_TARGET("sse2")
+ void CFFT_Scale_SSE2(double *FFT_T, int nn, double mult)
+ {
+     int i;
+     __m128d m = _mm_set1_pd(mult);
+
+     for(i = 0; i + 2 <= nn; i += 2)
+     {
+         _mm_storeu_pd(FFT_T + i, _mm_mul_pd(_mm_loadu_pd(FFT_T + i), m));
+     }
+
+     for(; i < nn; ++i)
+     {
+         FFT_T[i] *= mult;
+     }
+ }
+
+ /// <summary>
+ ///     (SSE2)
+ /// </summary>
+ SIMD_TARGET("sse2")
+ void CFFT_ScaleTW_SSE2(double *FFT_T, double *FFT_TWR, int nn)
+ {
+     int i;
+
+     for(i = 0; i < nn; i += 2)
+     {
+         _mm_storeu_pd(FFT_T + i, _mm_mul_pd(_mm_loadu_pd(FFT_T + i),
+                                             _mm_load1_pd(FFT_TWR + (i >> 1))));
+     }
+ }
+
+ /// <summary>
+ ///    DFT (SSE2)
+ /// </summary>
+ SIMD_TARGET("sse2")
+ void CFFT_SlideDFT_SSE2(double *FFT_SD, double *FFT_SDW, double *FFT_Old,
+                         double *FFT_New, int count, int nn)
+ {
+     int i, k;
+     __m128d neg, d, x;
+
+     neg = _mm_set_pd(0.0, -0.0);
+
+     for(i = 0; i < (count << 1); i += 2)
+     {
+         d = _mm_sub_pd(_mm_loadu_pd(FFT_New + i), _mm_loadu_pd(FFT_Old + i));
+
+         for(k = 0; k < nn; k += 2)
+         {
+             x = _mm_add_pd(_mm_loadu_pd(FFT_SD + k), d);
+             _mm_storeu_pd(FFT_SD + k, SSE2_CMUL(x, _mm_loadu_pd(FFT_SDW + k), neg));
+         }
+     }
+ }
+
+ //     :  (SIMD-)   k
+ #define SLIDE_TW_SSE2(k) \
+         _mm_add_pd(_mm_add_pd(_mm_mul_pd(c0, _mm_loadu_pd(FFT_SD + (k))), \
+                               _mm_mul_pd(c1, _mm_add_pd(_mm_loadu_pd(FFT_SD + (k) - 2), \
+                                                         _mm_loadu_pd(FFT_SD + (k) + 2)))), \
+                    _mm_add_pd(_mm_mul_pd(c2, _mm_add_pd(_mm_loadu_pd(FFT_SD + (k) - 4), \
+                                                         _mm_loadu_pd(FFT_SD + (k) + 4))), \
+                               _mm_mul_pd(c3, _mm_add_pd(_mm_loadu_pd(FFT_SD + (k) - 6), \
+                                                         _mm_loadu_pd(FFT_SD + (k) + 6)))))
+
+ /// <summary>
+ ///       (SSE2). ,
+ ///      , -  
+ /// </summary>
+ SIMD_TARGET("sse2")
+ void CFFT_SlideTW_SSE2(double *FFT_T, double *FFT_SD, double *c, int nn,
+                        int a, int b)
+ {
+     int k, k0, k1;
+     __m128d c0, c1, c2, c3;
+
+     c0 = _mm_set1_pd(c[0]);
+     c1 = _mm_set1_pd(c[1]);
+     c2 = _mm_set1_pd(c[2]);
+     c3 = _mm_set1_pd(c[3]);
+     k0 = min(max(a, 6), b);
+     k1 = max(min(b, nn - 6), k0);
+
+     CFFT_SlideTW(FFT_T, FFT_SD, c, nn, a, k0);
+
+     for(k = k0; k < k1; k += 2)
+     {
+         _mm_storeu_pd(FFT_T + k, SLIDE_TW_SSE2(k));
+     }
+
+     CFFT_SlideTW(FFT_T, FFT_SD, c, nn, k1, b);
+ }
+
+ //    ()   b:   -  
+ //  SSE2
+ #define GOERTZEL_SSE2(b, x) \
+         d##b = _mm_add_pd(_mm_add_pd(d##b, (x)), _mm_mul_pd(lm##b, s##b)); \
+         s##b = _mm_add_pd(s##b, d##b);
+
+ /// <summary>
+ ///    GOERTZEL_LANES (8)    (SSE2)
+ /// </summary>
+ SIMD_TARGET("sse2")
+ void CFFT_Goertzel_SSE2(double *FFT_S, double *FFT_TW, int n, double *sign,
+                         double *lambda, double *state)
+ {
+     int i;
+     __m128d x, m, sg0, sg1, sg2, sg3, sg4, sg5, sg6, sg7,
+             lm0, lm1, lm2, lm3, lm4, lm5, lm6, lm7,
+             d0, d1, d2, d3, d4, d5, d6, d7, s0, s1, s2, s3, s4, s5, s6, s7;
+
+     //      
+     m   = _mm_set1_pd(-0.0);
+     sg0 = _mm_and_pd(m, _mm_set1_pd(sign[0]));  lm0 = _mm_set1_pd(lambda[0]);
+     sg1 = _mm_and_pd(m, _mm_set1_pd(sign[1]));  lm1 = _mm_set1_pd(lambda[1]);
+     sg2 = _mm_and_pd(m, _mm_set1_pd(sign[2]));  lm2 = _mm_set1_pd(lambda[2]);
+     sg3 = _mm_and_pd(m, _mm_set1_pd(sign[3]));  lm3 = _mm_set1_pd(lambda[3]);
+     sg4 = _mm_and_pd(m, _mm_set1_pd(sign[4]));  lm4 = _mm_set1_pd(lambda[4]);
+     sg5 = _mm_and_pd(m, _mm_set1_pd(sign[5]));  lm5 = _mm_set1_pd(lambda[5]);
+     sg6 = _mm_and_pd(m, _mm_set1_pd(sign[6]));  lm6 = _mm_set1_pd(lambda[6]);
+     sg7 = _mm_and_pd(m, _mm_set1_pd(sign[7]));  lm7 = _mm_set1_pd(lambda[7]);
+
+     d0 = d1 = d2 = d3 = d4 = d5 = d6 = d7 = _mm_setzero_pd();
+     s0 = s1 = s2 = s3 = s4 = s5 = s6 = s7 = _mm_setzero_pd();
+
+     // n - :   
+     for(i = 0; i < n; i += 2)
+     {
+         x = _mm_loadu_pd(FFT_S + (i << 1));
+
+         if(FFT_TW != NULL)
+         {
+             x = _mm_mul_pd(x, _mm_load1_pd(FFT_TW + i));
+         }
+
+         GOERTZEL_SSE2(0, x) GOERTZEL_SSE2(1, x)
+         GOERTZEL_SSE2(2, x) GOERTZEL_SSE2(3, x)
+         GOERTZEL_SSE2(4, x) GOERTZEL_SSE2(5, x)
+         GOERTZEL_SSE2(6, x) GOERTZEL_SSE2(7, x)
+
+         x = _mm_loadu_pd(FFT_S + (i << 1) + 2);
+
+         if(FFT_TW != NULL)
+         {
+             x = _mm_mul_pd(x, _mm_load1_pd(FFT_TW + i + 1));
+         }
+
+         GOERTZEL_SSE2(0, _mm_xor_pd(x, sg0)) GOERTZEL_SSE2(1, _mm_xor_pd(x, sg1))
+         GOERTZEL_SSE2(2, _mm_xor_pd(x, sg2)) GOERTZEL_SSE2(3, _mm_xor_pd(x, sg3))
+         GOERTZEL_SSE2(4, _mm_xor_pd(x, sg4)) GOERTZEL_SSE2(5, _mm_xor_pd(x, sg5))
+         GOERTZEL_SSE2(6, _mm_xor_pd(x, sg6)) GOERTZEL_SSE2(7, _mm_xor_pd(x, sg7))
+     }
+
+     _mm_storeu_pd(state +  0, d0);  _mm_storeu_pd(state +  2, s0);
+     _mm_storeu_pd(state +  4, d1);  _mm_storeu_pd(state +  6, s1);
+     _mm_storeu_pd(state +  8, d2);  _mm_storeu_pd(state + 10, s2);
+     _mm_storeu_pd(state + 12, d3);  _mm_storeu_pd(state + 14, s3);
+     _mm_storeu_pd(state + 16, d4);  _mm_storeu_pd(state + 18, s4);
+     _mm_storeu_pd(state + 20, d5);  _mm_storeu_pd(state + 22, s5);
+     _mm_storeu_pd(state + 24, d6);  _mm_storeu_pd(state + 26, s6);
+     _mm_storeu_pd(state + 28, d7);  _mm_storeu_pd(state + 30, s7);
+ }
+
+ /// <summary>
+ ///     (SSE2,    )
+ /// </summary>
+ SIMD_TARGET("sse2")
+ void CFFT_Magnitude_SSE2(double *Z, int n, double *Mag)
+ {
+     int i;
+     __m128d a, b;
+
+     for(i = 0; i + 2 <= n; i += 2)
+     {
+         a = _mm_loadu_pd(Z + (i << 1) + 0);
+         b = _mm_loadu_pd(Z + (i << 1) + 2);
+         a = _mm_mul_pd(a, a);
+         b = _mm_mul_pd(b, b);
+
+         // (re0^2 + im0^2, re1^2 + im1^2)
+         _mm_storeu_pd(Mag + i, _mm_sqrt_pd(_mm_add_pd(_mm_unpacklo_pd(a, b),
+                                                      _mm_unpackhi_pd(a, b))));
+     }
+
+     CFFT_Magnitude(Z + (i << 1), n - i, Mag + i);
+ }
+
+ /// <summary>
+ ///     (SSE2,  ,
+ ///   - ,  )
+ /// </summary>
+ SIMD_TARGET("sse2")
+ void CFFT_ArgumentFast_SSE2(double *Z, int n, double *Arg)
+ {
+     int i;
+     __m128d a, b, re, im, ax, ay, t, r, m, sign, pi, pi_2, fmin;
+
+     sign = _mm_set1_pd(-0.0);
+     pi   = _mm_set1_pd(M_PI);
+     pi_2 = _mm_set1_pd(M_PI / 2);
+     fmin = _mm_set1_pd(FLOAT_MIN);
+
+     for(i = 0; i + 2 <= n; i += 2)
+     {
+         a  = _mm_loadu_pd(Z + (i << 1) + 0);
+         b  = _mm_loadu_pd(Z + (i << 1) + 2);
+         re = _mm_unpacklo_pd(a, b);
+         im = _mm_unpackhi_pd(a, b);
+         ax = _mm_andnot_pd(sign, re);
+         ay = _mm_andnot_pd(sign, im);
+
+         //   [0, 1] (0 / 0  re = im = 0  )
+         a = _mm_div_pd(_mm_min_pd(ax, ay), _mm_max_pd(ax, ay));
+         t = _mm_mul_pd(a, a);
+         r = _mm_set1_pd(ATAN_C7);
+         r = _mm_add_pd(_mm_mul_pd(r, t), _mm_set1_pd(ATAN_C6));
+         r = _mm_add_pd(_mm_mul_pd(r, t), _mm_set1_pd(ATAN_C5));
+         r = _mm_add_pd(_mm_mul_pd(r, t), _mm_set1_pd(ATAN_C4));
+         r = _mm_add_pd(_mm_mul_pd(r, t), _mm_set1_pd(ATAN_C3));
+         r = _mm_add_pd(_mm_mul_pd(r, t), _mm_set1_pd(ATAN_C2));
+         r = _mm_add_pd(_mm_mul_pd(r, t), _mm_set1_pd(ATAN_C1));
+         r = _mm_add_pd(_mm_mul_pd(r, t), _mm_set1_pd(ATAN_C0));
+         r = _mm_mul_pd(r, a);
+
+         // |im| > |re|: pi / 2 - r
+         m = _mm_cmpgt_pd(ay, ax);
+         r = _mm_or_pd(_mm_and_pd(m, _mm_sub_pd(pi_2, r)), _mm_andnot_pd(m, r));
+
+         // re < 0: pi - r
+         m = _mm_cmplt_pd(re, _mm_setzero_pd());
+         r = _mm_or_pd(_mm_and_pd(m, _mm_sub_pd(pi, r)), _mm_andnot_pd(m, r));
+
+         //   ; |re| < FLOAT_MIN -  (  Safe_atan2)
+         r = _mm_xor_pd(r, _mm_and_pd(sign, im));
+         r = _mm_and_pd(r, _mm_cmpge_pd(ax, fmin));
+
+         _mm_storeu_pd(Arg + i, r);
+     }
+
+     CFFT_ArgumentFast(Z + (i << 1), n - i, Arg + i);
+ }
+
+#ifdef SIMD_X86_AVX2
+
+ /// <summary>
+ ///  ""   2 (AVX2 + FMA)
+ /// </summary>
+ SIMD_TARGET("avx2,fma")
+ void CFFT_Radix2Stage_AVX2(double *FFT_T, int n, int h, double *W,
+                            int k0, int k1)
+ {
+     int g, k;
+     double *a, *b;
+     __m256d w, x0, x1, t;
+
+     //     -  SSE2
+     if(h < 2)
+     {
+         CFFT_Radix2Stage_SSE2(FFT_T, n, h, W, k0, k1);
+         return;
+     }
+
+     n <<= 1;
+     h <<= 1;
+
+     for(g = 0; g < n; g += (h << 1))
+     {
+         a = FFT_T + g;
+         b = a + h;
+
+         for(k = (k0 << 1); k < (k1 << 1); k += 4)
+         {
+             w  = _mm256_loadu_pd(W + k);
+             x0 = _mm256_loadu_pd(a + k);
+             x1 = _mm256_loadu_pd(b + k);
+             t  = AVX2_CMUL(x1, w);
+             _mm256_storeu_pd(a + k, _mm256_add_pd(x0, t));
+             _mm256_storeu_pd(b + k, _mm256_sub_pd(x0, t));
+         }
+     }
+ }
+
+ /// <summary>
+ ///  ""   4 (AVX2 + FMA)
+ /// </summary>
+ SIMD_TARGET("avx2,fma")
+ void CFFT_Radix4Stage_AVX2(double *FFT_T, int n, int h, double *W,
+                            bool direction, int k0, int k1)
+ {
+     int i, k, hh;
+     double *x;
+     __m256d rot, w1, w2, w3, x0, a1, a2, a3, t0, t1, t2, t3;
+
+     if(h < 2)
+     {
+         CFFT_Radix4Stage_SSE2(FFT_T, n, h, W, direction, k0, k1);
+         return;
+     }
+
+     rot = direction ? _mm256_set_pd(-0.0, 0.0, -0.0, 0.0) :
+                       _mm256_set_pd(0.0, -0.0, 0.0, -0.0);
+     hh  = h << 1;
+     n <<= 1;
+
+     for(k = (k0 << 1); k < (k1 << 1); k += 4)
+     {
+         w1 = _mm256_loadu_pd(W + (hh << 1) + k);
+         w2 = _mm256_loadu_pd(W + hh + k);
+         w3 = AVX2_CMUL(w1, w2);
+
+         for(i = k; i < n; i += (hh << 2))
+         {
+             x  = FFT_T + i;
+             x0 = _mm256_loadu_pd(x);
+             a1 = _mm256_loadu_pd(x + hh);
+             a2 = _mm256_loadu_pd(x + (hh << 1));
+             a3 = _mm256_loadu_pd(x + (hh << 1) + hh);
+             a1 = AVX2_CMUL(a1, w2);
+             a2 = AVX2_CMUL(a2, w1);
+             a3 = AVX2_CMUL(a3, w3);
+
+             t0 = _mm256_add_pd(x0, a1);
+             t1 = _mm256_sub_pd(x0, a1);
+             t2 = _mm256_add_pd(a2, a3);
+             t3 = _mm256_sub_pd(a2, a3);
+             t3 = _mm256_xor_pd(_mm256_permute_pd(t3, 0x5), rot);
+
+             _mm256_storeu_pd(x,                  _mm256_add_pd(t0, t2));
+             _mm256_storeu_pd(x + hh,             _mm256_add_pd(t1, t3));
+             _mm256_storeu_pd(x + (hh << 1),      _mm256_sub_pd(t0, t2));
+             _mm256_storeu_pd(x + (hh << 1) + hh, _mm256_sub_pd(t1, t3));
+         }
+     }
+ }
+
+ /// <summary>
+ ///   (AVX2)
+ /// </summary>
+ SIMD_TARGET("avx2")
+ void CFFT_Scale_AVX2(double *FFT_T, int nn, double mult)
+ {
+     int i;
+     __m256d m = _mm256_set1_pd(mult);
+
+     for(i = 0; i + 4 <= nn; i += 4)
+     {
+         _mm256_storeu_pd(FFT_T + i, _mm256_mul_pd(_mm256_loadu_pd(FFT_T + i), m));
+     }
+
+     for(; i < nn; ++i)
+     {
+         FFT_T[i] *= mult;
+     }
+ }
+
+ /// <summary>
+ ///    DFT (AVX2 + FMA,    )
+ /// </summary>
+ SIMD_TARGET("avx2,fma")
+ void CFFT_SlideDFT_AVX2(double *FFT_SD, double *FFT_SDW, double *FFT_Old,
+                         double *FFT_New, int count, int nn)
+ {
+     int i, k;
+     __m128d d;
+     __m256d dd, x;
+
+     for(i = 0; i < (count << 1); i += 2)
+     {
+         d  = _mm_sub_pd(_mm_loadu_pd(FFT_New + i), _mm_loadu_pd(FFT_Old + i));
+         dd = _mm256_broadcast_pd(&d);
+
+         // nn  4 (N >= MIN_FRAME_WIDTH)
+         for(k = 0; k < nn; k += 4)
+         {
+             x = _mm256_add_pd(_mm256_loadu_pd(FFT_SD + k), dd);
+             _mm256_storeu_pd(FFT_SD + k, AVX2_CMUL(x, _mm256_loadu_pd(FFT_SDW + k)));
+         }
+     }
+ }
+
+ //     :  ,    k (AVX2)
+ #define SLIDE_TW_AVX2(k) \
+         _mm256_fmadd_pd(c3, _mm256_add_pd(_mm256_loadu_pd(FFT_SD + (k) - 6), \
+                                           _mm256_loadu_pd(FFT_SD + (k) + 6)), \
+         _mm256_fmadd_pd(c2, _mm256_add_pd(_mm256_loadu_pd(FFT_SD + (k) - 4), \
+                                           _mm256_loadu_pd(FFT_SD + (k) + 4)), \
+         _mm256_fmadd_pd(c1, _mm256_add_pd(_mm256_loadu_pd(FFT_SD + (k) - 2), \
+                                           _mm256_loadu_pd(FFT_SD + (k) + 2)), \
+                         _mm256_mul_pd(c0, _mm256_loadu_pd(FFT_SD + (k))))))
+
+ /// <summary>
+ ///       (AVX2 + FMA)
+ /// </summary>
+ SIMD_TARGET("avx2,fma")
+ void CFFT_SlideTW_AVX2(double *FFT_T, double *FFT_SD, double *c, int nn,
+                        int a, int b)
+ {
+     int k, k0, k1;
+     __m256d c0, c1, c2, c3;
+
+     c0 = _mm256_set1_pd(c[0]);
+     c1 = _mm256_set1_pd(c[1]);
+     c2 = _mm256_set1_pd(c[2]);
+     c3 = _mm256_set1_pd(c[3]);
+     k0 = min(max(a, 6), b);
+     k1 = k0 + (((max(min(b, nn - 6), k0)) - k0) & ~3);
+
+     CFFT_SlideTW(FFT_T, FFT_SD, c, nn, a, k0);
+
+     for(k = k0; k < k1; k += 4)
+     {
+         _mm256_storeu_pd(FFT_T + k, SLIDE_TW_AVX2(k));
+     }
+
+     CFFT_SlideTW(FFT_T, FFT_SD, c, nn, k1, b);
+ }
+
+ //    ()    b (AVX2 + FMA)
+ #define GOERTZEL_AVX2(b, x) \
+         d##b = _mm256_fmadd_pd(lm##b, s##b, _mm256_add_pd(d##b, (x))); \
+         s##b = _mm256_add_pd(s##b, d##b);
+
+ /// <summary>
+ ///    GOERTZEL_LANES (8)   
+ /// (AVX2 + FMA,    )
+ /// </summary>
+ SIMD_TARGET("avx2,fma")
+ void CFFT_Goertzel_AVX2(double *FFT_S, double *FFT_TW, int n, double *sign,
+                         double *lambda, double *state)
+ {
+     int i;
+     __m256d x, m, sg0, sg1, sg2, sg3, lm0, lm1, lm2, lm3,
+             d0, d1, d2, d3, s0, s1, s2, s3;
+
+     m   = _mm256_set1_pd(-0.0);
+     sg0 = _mm256_and_pd(m, _mm256_set_pd(sign[1], sign[1], sign[0], sign[0]));
+     sg1 = _mm256_and_pd(m, _mm256_set_pd(sign[3], sign[3], sign[2], sign[2]));
+     sg2 = _mm256_and_pd(m, _mm256_set_pd(sign[5], sign[5], sign[4], sign[4]));
+     sg3 = _mm256_and_pd(m, _mm256_set_pd(sign[7], sign[7], sign[6], sign[6]));
+     lm0 = _mm256_set_pd(lambda[1], lambda[1], lambda[0], lambda[0]);
+     lm1 = _mm256_set_pd(lambda[3], lambda[3], lambda[2], lambda[2]);
+     lm2 = _mm256_set_pd(lambda[5], lambda[5], lambda[4], lambda[4]);
+     lm3 = _mm256_set_pd(lambda[7], lambda[7], lambda[6], lambda[6]);
+
+     d0 = d1 = d2 = d3 = _mm256_setzero_pd();
+     s0 = s1 = s2 = s3 = _mm256_setzero_pd();
+
+     for(i = 0; i < n; i += 2)
+     {
+         x = _mm256_broadcast_pd((__m128d *)(FFT_S + (i << 1)));
+
+         if(FFT_TW != NULL)
+         {
+             x = _mm256_mul_pd(x, _mm256_broadcast_sd(FFT_TW + i));
+         }
+
+         GOERTZEL_AVX2(0, x) GOERTZEL_AVX2(1, x)
+         GOERTZEL_AVX2(2, x) GOERTZEL_AVX2(3, x)
+
+         x = _mm256_broadcast_pd((__m128d *)(FFT_S + (i << 1) + 2));
+
+         if(FFT_TW != NULL)
+         {
+             x = _mm256_mul_pd(x, _mm256_broadcast_sd(FFT_TW + i + 1));
+         }
+
+         GOERTZEL_AVX2(0, _mm256_xor_pd(x, sg0))
+         GOERTZEL_AVX2(1, _mm256_xor_pd(x, sg1))
+         GOERTZEL_AVX2(2, _mm256_xor_pd(x, sg2))
+         GOERTZEL_AVX2(3, _mm256_xor_pd(x, sg3))
+     }
+
+     //  : (d, s)     
+     _mm256_storeu_pd(state +  0, _mm256_permute2f128_pd(d0, s0, 0x20));
+     _mm256_storeu_pd(state +  4, _mm256_permute2f128_pd(d0, s0, 0x31));
+     _mm256_storeu_pd(state +  8, _mm256_permute2f128_pd(d1, s1, 0x20));
+     _mm256_storeu_pd(state + 12, _mm256_permute2f128_pd(d1, s1, 0x31));
+     _mm256_storeu_pd(state + 16, _mm256_permute2f128_pd(d2, s2, 0x20));
+     _mm256_storeu_pd(state + 20, _mm256_permute2f128_pd(d2, s2, 0x31));
+     _mm256_storeu_pd(state + 24, _mm256_permute2f128_pd(d3, s3, 0x20));
+     _mm256_storeu_pd(state + 28, _mm256_permute2f128_pd(d3, s3, 0x31));
+ }
+
+#endif
+
+#ifdef SIMD_X86_AVX512
+
+ /// <summary>
+ ///  ""   2 (AVX-512F)
+ /// </summary>
+ SIMD_TARGET("avx512f")
+ void CFFT_Radix2Stage_AVX512(double *FFT_T, int n, int h, double *W,
+                              int k0, int k1)
+ {
+     int g, k;
+     double *a, *b;
+     __m512d w, x0, x1, t;
+
+     if(h < 4)
+     {
+         CFFT_Radix2Stage_AVX2(FFT_T, n, h, W, k0, k1);
+         return;
+     }
+
+     n <<= 1;
+     h <<= 1;
+
+     for(g = 0; g < n; g += (h << 1))
+     {
+         a = FFT_T + g;
+         b = a + h;
+
+         for(k = (k0 << 1); k < (k1 << 1); k += 8)
+         {
+             w  = _mm512_loadu_pd(W + k);
+             x0 = _mm512_loadu_pd(a + k);
+             x1 = _mm512_loadu_pd(b + k);
+             t  = AVX512_CMUL(x1, w);
+             _mm512_storeu_pd(a + k, _mm512_add_pd(x0, t));
+             _mm512_storeu_pd(b + k, _mm512_sub_pd(x0, t));
+         }
+     }
+ }
+
+ /// <summary>
+ ///  ""   4 (AVX-512F)
+ /// </summary>
+ SIMD_TARGET("avx512f")
+ void CFFT_Radix4Stage_AVX512(double *FFT_T, int n, int h, double *W,
+                              bool direction, int k0, int k1)
+ {
+     int i, k, hh;
+     double *x;
+     __m512d w1, w2, w3, x0, a1, a2, a3, t0, t1, t2, t3;
+     __m512i rot;
+
+     if(h < 4)
+     {
+         CFFT_Radix4Stage_AVX2(FFT_T, n, h, W, direction, k0, k1);
+         return;
+     }
+
+     //      -+i (AVX-512F   xor_pd)
+     rot = _mm512_castpd_si512(direction ?
+               _mm512_set_pd(-0.0, 0.0, -0.0, 0.0, -0.0, 0.0, -0.0, 0.0) :
+               _mm512_set_pd(0.0, -0.0, 0.0, -0.0, 0.0, -0.0, 0.0, -0.0));
+     hh  = h << 1;
+     n <<= 1;
+
+     for(k = (k0 << 1); k < (k1 << 1); k += 8)
+     {
+         w1 = _mm512_loadu_pd(W + (hh << 1) + k);
+         w2 = _mm512_loadu_pd(W + hh + k);
+         w3 = AVX512_CMUL(w1, w2);
+
+         for(i = k; i < n; i += (hh << 2))
+         {
+             x  = FFT_T + i;
+             x0 = _mm512_loadu_pd(x);
+             a1 = _mm512_loadu_pd(x + hh);
+             a2 = _mm512_loadu_pd(x + (hh << 1));
+             a3 = _mm512_loadu_pd(x + (hh << 1) + hh);
+             a1 = AVX512_CMUL(a1, w2);
+             a2 = AVX512_CMUL(a2, w1);
+             a3 = AVX512_CMUL(a3, w3);
+
+             t0 = _mm512_add_pd(x0, a1);
+             t1 = _mm512_sub_pd(x0, a1);
+             t2 = _mm512_add_pd(a2, a3);
+             t3 = _mm512_sub_pd(a2, a3);
+             t3 = _mm512_castsi512_pd(
+                      _mm512_xor_si512(_mm512_castpd_si512(_mm512_permute_pd(t3, 0x55)),
+                                       rot));
+
+             _mm512_storeu_pd(x,                  _mm512_add_pd(t0, t2));
+             _mm512_storeu_pd(x + hh,             _mm512_add_pd(t1, t3));
+             _mm512_storeu_pd(x + (hh << 1),      _mm512_sub_pd(t0, t2));
+             _mm512_storeu_pd(x + (hh << 1) + hh, _mm512_sub_pd(t1, t3));
+         }
+     }
+ }
+
+ /// <summary>
+ ///   (AVX-512F)
+ /// </summary>
+ SIMD_TARGET("avx512f")
+ void CFFT_Scale_AVX512(double *FFT_T, int nn, double mult)
+ {
+     int i;
+     __m512d m = _mm512_set1_pd(mult);
+
+     for(i = 0; i + 8 <= nn; i += 8)
+     {
+         _mm512_storeu_pd(FFT_T + i, _mm512_mul_pd(_mm512_loadu_pd(FFT_T + i), m));
+     }
+
+     for(; i < nn; ++i)
+     {
+         FFT_T[i] *= mult;
+     }
+ }
+
+#endif
+
+#endif
+
+ /// <summary>
+ ///     FFT   SIMD
+ /// (   )
+ /// </summary>
+ /// <param name="fftObj">  FFT,    . </param>
+ /// <param name="level">   SIMD (SIMD_NONE ... SIMD_AVX512). </param>
+ /// <returns>    SIMD. </returns>
+ int CFFT_SetSIMD(CFFT_Object *fftObj, int level)
+ {
+     //   -  
+     fftObj->Radix2Stage = CFFT_Radix2Stage;
+     fftObj->Radix4Stage = CFFT_Radix4Stage;
+     fftObj->Gather      = CFFT_Gather;
+     fftObj->GatherTW    = CFFT_GatherTW;
+     fftObj->FoldTW      = CFFT_FoldTW;
+     fftObj->Scale       = CFFT_Scale;
+     fftObj->ScaleTW     = CFFT_ScaleTW;
+     fftObj->Magnitude   = CFFT_Magnitude;
+     fftObj->Argument    = (fftObj->ArgMode == ARG_FAST) ?
+                           CFFT_ArgumentFast : CFFT_Argument;
+     fftObj->SlideDFT    = CFFT_SlideDFT;
+     fftObj->SlideTW     = CFFT_SlideTW;
+     fftObj->Goertzel    = CFFT_Goertzel;
+
+#ifdef SIMD_X86
+
+     level = min(level, CFFT_DetectSIMD());
+
+     if(level >= SIMD_SSE2)
+     {
+         //      -
+         //     128- 
+         fftObj->Radix2Stage = CFFT_Radix2Stage_SSE2;
+         fftObj->Radix4Stage = CFFT_Radix4Stage_SSE2;
+         fftObj->Gather      = CFFT_Gather_SSE2;
+         fftObj->GatherTW    = CFFT_GatherTW_SSE2;
+         fftObj->FoldTW      = CFFT_FoldTW_SSE2;
+         fftObj->Scale       = CFFT_Scale_SSE2;
+         fftObj->ScaleTW     = CFFT_ScaleTW_SSE2;
+         fftObj->Magnitude   = CFFT_Magnitude_SSE2;
+         fftObj->SlideDFT    = CFFT_SlideDFT_SSE2;
+         fftObj->SlideTW     = CFFT_SlideTW_SSE2;
+         fftObj->Goertzel    = CFFT_Goertzel_SSE2;
+
+         //     atan2  -   
+         if(fftObj->ArgMode == ARG_FAST)
+         {
+             fftObj->Argument = CFFT_ArgumentFast_SSE2;
+         }
+     }
+
+#ifdef SIMD_X86_AVX2
+     if(level >= SIMD_AVX2)
+     {
+         fftObj->Radix2Stage = CFFT_Radix2Stage_AVX2;
+         fftObj->Radix4Stage = CFFT_Radix4Stage_AVX2;
+         fftObj->Scale       = CFFT_Scale_AVX2;
+         fftObj->SlideDFT    = CFFT_SlideDFT_AVX2;
+         fftObj->SlideTW     = CFFT_SlideTW_AVX2;
+         fftObj->Goertzel    = CFFT_Goertzel_AVX2;
+     }
+#endif
+
+#ifdef SIMD_X86_AVX512
+     if(level >= SIMD_AVX512)
+     {
+         fftObj->Radix2Stage = CFFT_Radix2Stage_AVX512;
+         fftObj->Radix4Stage = CFFT_Radix4Stage_AVX512;
+         fftObj->Scale       = CFFT_Scale_AVX512;
+     }
+#endif
+
+#else
+
+     level = SIMD_NONE;
+
+#endif
+
+     fftObj->SIMD = level;
+
+     return level;
+ }
+
+ /// <summary>
+ ///     ()   
+ /// (ArgL, ArgR, PhaseLR  CFFT_Explore, Arg  CFFT_ComplexExplore)
+ /// </summary>
+ /// <param name="fftObj">  FFT,    . </param>
+ /// <param name="mode">  (ARG_EXACT - atan2 ,
+ /// ARG_FAST -  ,  < 1E-7 ). </param>
+ /// <returns>  . </returns>
+ int CFFT_SetArgMode(CFFT_Object *fftObj, int mode)
+ {
+     fftObj->ArgMode = (mode == ARG_FAST) ? ARG_FAST : ARG_EXACT;
+     CFFT_SetSIMD(fftObj, fftObj->SIMD);
+
+     return fftObj->ArgMode;
+ }
+
+ /// <summary>
+ ///   :       
+ /// </summary>
+ /// <param name="param">    (CFFT_PoolWorker). </param>
+ DWORD WINAPI CFFT_PoolWorkerProc(LPVOID param)
+ {
+     CFFT_PoolWorker *worker = (CFFT_PoolWorker *)param;
+     CFFT_Pool *pool = worker->Pool;
+
+     for(;;)
+     {
+         WaitForSingleObject((HANDLE)pool->Start[worker->Part - 1], INFINITE);
+
+         if(pool->Quit)
+         {
+             break;
+         }
+
+         pool->Task(pool->Ctx, worker->Part, pool->Threads);
+
+         //      
+         if(InterlockedDecrement(&pool->Pending) == 0)
+         {
+             SetEvent((HANDLE)pool->Done);
+         }
+     }
+
+     return 0;
+ }
+
+ /// <summary>
+ ///     (  )
+ /// </summary>
+ /// <param name="threads"> -  ( ). </param>
+ /// <returns>   . </returns>
+ CFFT_Pool * CFFT_PoolCreate(int threads)
+ {
+     int i;
+     CFFT_Pool *pool = (CFFT_Pool *)calloc(1, sizeof(CFFT_Pool));
+
+     pool->Threads = threads;
+     pool->Handles = (void **)calloc(threads - 1, sizeof(void *));
+     pool->Start   = (void **)calloc(threads - 1, sizeof(void *));
+     pool->Workers = (CFFT_PoolWorker *)calloc(threads - 1, sizeof(CFFT_PoolWorker));
+     pool->Done    = CreateEvent(NULL, FALSE, FALSE, NULL);
+
+     for(i = 0; i < (threads - 1); ++i)
+     {
+         pool->Workers[i].Pool = pool;
+         pool->Workers[i].Part = i + 1;
+         pool->Start[i]   = CreateEvent(NULL, FALSE, FALSE, NULL);
+         pool->Handles[i] = CreateThread(NULL, 0, CFFT_PoolWorkerProc,
+                                         &pool->Workers[i], 0, NULL);
+     }
+
+     return pool;
+ }
+
+ /// <summary>
+ ///    
+ /// </summary>
+ /// <param name="pool">   . </param>
+ void CFFT_PoolDestroy(CFFT_Pool *pool)
+ {
+     int i;
+
+     if(pool == NULL)
+     {
+         return;
+     }
+
+     InterlockedExchange(&pool->Quit, 1);
+
+     for(i = 0; i < (pool->Threads - 1); ++i)
+     {
+         SetEvent((HANDLE)pool->Start[i]);
+     }
+
+     for(i = 0; i < (pool->Threads - 1); ++i)
+     {
+         WaitForSingleObject((HANDLE)pool->Handles[i], INFINITE);
+         CloseHandle((HANDLE)pool->Handles[i]);
+         CloseHandle((HANDLE)pool->Start[i]);
+     }
+
+     CloseHandle((HANDLE)pool->Done);
+
+     SAFE_DELETE(pool->Handles);
+     SAFE_DELETE(pool->Start);
+     SAFE_DELETE(pool->Workers);
+     SAFE_DELETE(pool);
+ }
+
+ /// <summary>
+ ///       (  
+ ///  "0").        -  
+ ///    
+ /// </summary>
+ /// <param name="pool">    (  NULL). </param>
+ /// <param name="task"> . </param>
+ /// <param name="ctx">  . </param>
+ void CFFT_PoolRun(CFFT_Pool *pool, CFFT_PoolTask task, void *ctx)
+ {
+     int i;
+
+     if((pool == NULL) || (InterlockedCompareExchange(&pool->Busy, 1, 0) != 0))
+     {
+         task(ctx, 0, 1);
+         return;
+     }
+
+     pool->Task    = task;
+     pool->Ctx     = ctx;
+     pool->Pending = pool->Threads - 1;
+
+     for(i = 0; i < (pool->Threads - 1); ++i)
+     {
+         SetEvent((HANDLE)pool->Start[i]);
+     }
+
+     task(ctx, 0, pool->Threads);
+
+     WaitForSingleObject((HANDLE)pool->Done, INFINITE);
+     InterlockedExchange(&pool->Busy, 0);
+ }
+
+ /// <summary>
+ ///  -    FFT
+ /// </summary>
+ /// <param name="fftObj">  FFT,    . </param>
+ /// <param name="threads"> -  ("0" -   ,
+ /// "1" -  ). </param>
+ /// <returns>  - . </returns>
+ int CFFT_SetThreads(CFFT_Object *fftObj, int threads)
+ {
+     SYSTEM_INFO sysInfo;
+
+     if(threads <= 0)
+     {
+         GetSystemInfo(&sysInfo);
+         threads = (int)sysInfo.dwNumberOfProcessors;
+     }
+
+     CFFT_PoolDestroy(fftObj->Pool);
+     fftObj->Pool = NULL;
+
+     if(threads > 1)
+     {
+         fftObj->Pool = CFFT_PoolCreate(threads);
+
+     } else
+     {
+         threads = 1;
+     }
+
+     return threads;
+ }
+
+ /// <summary>
+ ///      FFT.   PERMUTE_INPLACE
+ ///  FFT_P (2N )     FFT_SW
+ /// ( N ),    FFT_T  
+ ///    -  FFT_S == FFT_T
+ /// </summary>
+ /// <param name="fftObj">  FFT,    . </param>
+ /// <param name="permutation">   (PERMUTE_TABLE /
+ /// PERMUTE_INPLACE). </param>
+ /// <returns>   . </returns>
+ int CFFT_SetPermutation(CFFT_Object *fftObj, int permutation)
+ {
+     if(permutation == PERMUTE_INPLACE)
+     {
+         fill_FFT_SW(fftObj);
+
+         //     -    
+         // 
+         if((fftObj->Plan != NULL) && (fftObj->FFT_P == fftObj->Plan->FFT_P))
+         {
+             fftObj->FFT_P = NULL;
+         }
+
+         SAFE_DELETE(fftObj->FFT_P);
+
+     } else
+     {
+         permutation = PERMUTE_TABLE;
+
+         if((fftObj->FFT_P == NULL) && (fftObj->Plan != NULL))
+         {
+             fftObj->FFT_P = fftObj->Plan->FFT_P;
+         }
+
+         if(fftObj->FFT_P == NULL)
+         {
+             fill_FFT_P(fftObj);
+         }
+
+         SAFE_DELETE(fftObj->FFT_SW);
+         fftObj->SwapCount = 0;
+     }
+
+     fftObj->Permutation = permutation;
+
+     return permutation;
+ }
+
+ /// <summary>
+ ///   FFT     (  NN
+ /// ,  SIMD_ALIGN ).     
+ ///   ;    
+ ///     .   
+ ///      ( ..     
+ ///  ,   FFT  ): ,  
+ ///   ,      
+ /// (CFFT_BufferOverlaps)     
+ /// </summary>
+ /// <param name="fftObj">  FFT,    . </param>
+ /// <param name="buffer">   (NULL - ). </param>
+ /// <param name="count">   (). </param>
+ /// <returns>  ? </returns>
+ bool CFFT_SetBuffer(CFFT_Object *fftObj, double *buffer, int count)
+ {
+     if((buffer != NULL) &&
+        ((((size_t)buffer & (SIMD_ALIGN - 1)) != 0) || (count < fftObj->NN)))
+     {
+         return FALSE;
+     }
+
+     fftObj->FFT_B      = buffer;
+     fftObj->BufferSize = (buffer != NULL) ? count : 0;
+
+     return TRUE;
+ }
+
+ /// <summary>
+ ///       (CFFT_SetBuffer) 
+ ///  ? ,   ,    
+ ///   
+ /// </summary>
+ /// <param name="fftObj">  FFT,    . </param>
+ /// <param name="data">   (NULL -  ). </param>
+ /// <param name="count">   (). </param>
+ /// <returns>    ? </returns>
+ bool CFFT_BufferOverlaps(CFFT_Object *fftObj, double *data, int count)
+ {
+     return (fftObj->FFT_B != NULL) && (data != NULL) &&
+            ((size_t)data < (size_t)(fftObj->FFT_B + fftObj->BufferSize)) &&
+            ((size_t)fftObj->FFT_B < (size_t)(data + count));
+ }
+
+ /// <summary>
+ /// ""  FFT
+ /// </summary>
+ /// <param name="fftObj">  FFT,    . </param>
+ /// <returns>     FFT. </returns>
+ int CFFT_Inspector(CFFT_Object *fftObj)
+ {
+     //       -!
+     if((fftObj->N     < MIN_FRAME_WIDTH) ||
+        (fftObj->NPoly < MIN_FRAME_WIDTH) ||
+        (fftObj->Beta  > MAX_KAISER_BETA))
+     {
+         return FALSE;
+     }
+
+     //   FFT -      
+     if((fftObj->BlockSize < MIN_FRAME_WIDTH) ||
+        (fftObj->BlockSize & (fftObj->BlockSize - 1)))
+     {
+         return FALSE;
+     }
+
+     //    ""  FFT
+     if((fftObj->Engine != RADIX_2) &&
+        (fftObj->Engine != RADIX_4))
+     {
+         return FALSE;
+     }
+
+     return TRUE;
+ }
+
+ //---------------------------------------------
+ //-   FFT (   )
+ //---------------------------------------------
+ CFFT_Plan *CFFT_PlanCache = NULL;   //  
+ volatile long CFFT_PlanCacheLock = 0; //   
+
+ /// <summary>
+ ///    
+ /// </summary>
+ void CFFT_PlanLock(void)
+ {
+     while(InterlockedCompareExchange(&CFFT_PlanCacheLock, 1, 0) != 0)
+     {
+         Sleep(0);
+     }
+ }
+
+ /// <summary>
+ ///    
+ /// </summary>
+ void CFFT_PlanUnlock(void)
+ {
+     InterlockedExchange(&CFFT_PlanCacheLock, 0);
+ }
+
+ /// <summary>
+ ///     (  ).   
+ ///  "beta"    
+ /// </summary>
+ /// <param name="fftObj">  FFT    . </param>
+ /// <returns>  (   )  NULL. </returns>
+ CFFT_Plan * CFFT_PlanFind(CFFT_Object *fftObj)
+ {
+     CFFT_Plan *plan;
+
+     for(plan = CFFT_PlanCache; plan != NULL; plan = plan->Next)
+     {
+         if((plan->N       == fftObj->N)       &&
+            (plan->CosTW   == fftObj->CosTW)   &&
+            (plan->PolyDiv == fftObj->PolyDiv) &&
+            ((fftObj->CosTW != NONE) || (plan->Beta == fftObj->Beta)))
+         {
+             ++plan->Refs;
+             return plan;
+         }
+     }
+
+     return NULL;
+ }
+
+ /// <summary>
+ ///   FFT  :     
+ ///  (  ,  , )
+ /// </summary>
+ /// <param name="fftObj">  FFT,    . </param>
+ /// <param name="plan">  (    ). </param>
+ void CFFT_PlanAttach(CFFT_Object *fftObj, CFFT_Plan *plan)
+ {
+     SAFE_DELETE(fftObj->FFT_P);
+     SAFE_DELETE(fftObj->FFT_PP);
+     SAFE_DELETE(fftObj->FFT_TW);
+     SAFE_DELETE(fftObj->FFT_WD);
+     SAFE_DELETE(fftObj->FFT_WR);
+
+     fftObj->Plan   = plan;
+     fftObj->FFT_P  = plan->FFT_P;
+     fftObj->FFT_PP = plan->FFT_PP;
+     fftObj->FFT_TW = plan->FFT_TW;
+     fftObj->FFT_WD = plan->FFT_WD;
+     fftObj->FFT_WR = plan->FFT_WR;
+ }
+
+ /// <summary>
+ ///   FFT  :    
+ /// ,        
+ /// </summary>
+ /// <param name="fftObj">  FFT,    . </param>
+ void CFFT_PlanDetach(CFFT_Object *fftObj)
+ {
+     CFFT_Plan *plan = fftObj->Plan, **link;
+
+     if(plan == NULL)
+     {
+         return;
+     }
+
+     if(fftObj->FFT_P == plan->FFT_P)
+     {
+         fftObj->FFT_P = NULL;
+     }
+
+     if(fftObj->FFT_PP == plan->FFT_PP)
+     {
+         fftObj->FFT_PP = NULL;
+     }
+
+     if(fftObj->FFT_TW == plan->FFT_TW)
+     {
+         fftObj->FFT_TW = NULL;
+     }
+
+     if(fftObj->FFT_WD == plan->FFT_WD)
+     {
+         fftObj->FFT_WD = NULL;
+     }
+
+     if(fftObj->FFT_WR == plan->FFT_WR)
+     {
+         fftObj->FFT_WR = NULL;
+     }
+
+     fftObj->Plan = NULL;
+
+     CFFT_PlanLock();
+
+     if(--plan->Refs > 0)
+     {
+         CFFT_PlanUnlock();
+         return;
+     }
+
+     for(link = &CFFT_PlanCache; *link != NULL; link = &(*link)->Next)
+     {
+         if(*link == plan)
+         {
+             *link = plan->Next;
+             break;
+         }
+     }
+
+     CFFT_PlanUnlock();
+
+     //  ,   ,  
+     if(plan->MapView != NULL)
+     {
+         UnmapViewOfFile(plan->MapView);
+         CloseHandle((HANDLE)plan->MapHandle);
+         CloseHandle((HANDLE)plan->MapFile);
+         SAFE_DELETE(plan);
+         return;
+     }
+
+     SAFE_DELETE(plan->FFT_P);
+     SAFE_DELETE(plan->FFT_PP);
+     SAFE_DELETE(plan->FFT_TW);
+     SAFE_DELETE(plan->FFT_WD);
+     SAFE_DELETE(plan->FFT_WR);
+     SAFE_DELETE(plan);
+ }
+
+ /// <summary>
+ /// ""  FFT
+ /// </summary>
+ /// <param name="fftObj">  FFT,    . </param>
+ void CFFT_Destructor(CFFT_Object *fftObj)
+ {
+     CFFT_PlanDetach(fftObj);
+     SAFE_DELETE(fftObj->FFT_P);
+     SAFE_DELETE(fftObj->FFT_PP);
+     SAFE_DELETE(fftObj->FFT_SW);
+     SAFE_DELETE(fftObj->FFT_TW);
+     SAFE_DELETE(fftObj->FFT_TWR);
+     SAFE_DELETE(fftObj->FFT_TWS);
+     SAFE_DELETE(fftObj->FFT_WD);
+     SAFE_DELETE(fftObj->FFT_WR);
+     SAFE_DELETE(fftObj->FFT_PS);
+     SAFE_DELETE(fftObj->FFT_SD);
+     SAFE_DELETE(fftObj->FFT_SDW);
+     CFFT_PoolDestroy(fftObj->Pool);
+     SAFE_DELETE(fftObj);
+ }
+
+ /// <summary>
+ ///    FFT (  )
+ /// </summary>
+ /// <param name="fftObj">  FFT,    . </param>
+ /// <param name="frameWidth">  . </param>
+ /// <param name="cosTW">     (  -   ). </param>
+ /// <param name="beta">    . </param>
+ /// <param name="polyDiv2">     . </param>
+ /// <param name="engine">  ""  FFT (RADIX_2 / RADIX_4). </param>
+ void CFFT_InitFields(CFFT_Object *fftObj, int frameWidth, int cosTW,
+                      double beta, int polyDiv2, int engine)
+ {
+     fftObj->N = ToLowerPowerOf2(frameWidth);  //   FFT
+     fftObj->NN = fftObj->N << 1;              // -  (re + im)
+     fftObj->NPoly = fftObj->N >> polyDiv2;    //    FFT
+     fftObj->CosTW = cosTW;                    //    
+     fftObj->NNPoly = fftObj->NPoly << 1;      // -   FFT
+     fftObj->Beta = beta;                      // - .  
+     fftObj->PolyDiv = 1 << polyDiv2;          //  
+     fftObj->Engine = engine;                  // ""  FFT
+     fftObj->Permutation = PERMUTE_TABLE;      //   FFT_P
+     fftObj->BlockN = BLOCKED_FFT_THRESHOLD;   //     FFT
+     fftObj->BlockSize = BLOCKED_FFT_BLOCK;    //    FFT
+     fftObj->ParallelN = PARALLEL_FFT_THRESHOLD; //   
+     fftObj->Pool = NULL;                      //  
+     fftObj->Plan = NULL;                      //  
+
+     CFFT_SetSIMD(fftObj, SIMD_AVX512); //     SIMD
+ }
+
+ /// <summary>
+ ///    FFT (, , )
+ /// </summary>
+ /// <param name="fftObj">  FFT,    . </param>
+ void CFFT_InitTables(CFFT_Object *fftObj)
+ {
+     fill_FFT_P(fftObj);  //    .   FFT
+     fill_FFT_PP(fftObj); //   ... (  FFT)
+     fill_FFT_W(fftObj);  //   
+
+     if(fftObj->CosTW == NONE) //...      
+     {
+         fill_FFT_TW_Kaiser(fftObj); //   
+
+     } else
+     {
+         fill_FFT_TW_Cosine(fftObj); //   
+     }
+ }
+
+ /// <summary>
+ ///     FFT (CFFT_InitTables)  
+ ///    
+ /// </summary>
+ /// <param name="fftObj">  FFT,    . </param>
+ /// <param name="N_iters">   . </param>
+ /// <returns>     (). </returns>
+ double CFFT_InitTime(CFFT_Object *fftObj, int N_iters)
+ {
+     LARGE_INTEGER startCounter, CFFT_Init_counter, timerFrequency;
+     CFFT_Object *testObj;
+     int i;
+
+     testObj = (CFFT_Object *)calloc(1, sizeof(CFFT_Object));
+     CFFT_InitFields(testObj, fftObj->N, fftObj->CosTW, fftObj->Beta,
+                     Log2Int(fftObj->PolyDiv), fftObj->Engine);
+
+     QueryPerformanceFrequency(&timerFrequency);
+     QueryPerformanceCounter(&startCounter);
+     for(i = 0; i < N_iters; ++i)
+     {
+        CFFT_InitTables(testObj);
+     }
+     QueryPerformanceCounter(&CFFT_Init_counter);
+     CFFT_Init_counter.QuadPart -= startCounter.QuadPart;
+
+     CFFT_Destructor(testObj);
+
+     return ((long double)CFFT_Init_counter.QuadPart /
+             (long double)timerFrequency.QuadPart) / (double)N_iters;
+ }
+
+ /// <summary>
+ ///   FFT
+ /// </summary>
+ /// <param name="frameWidth">  . </param>
+ /// <param name="cosTW">     (  -   ). </param>
+ /// <param name="beta">    . </param>
+ /// <param name="polyDiv2">     . </param>
+ /// <param name="engine">  ""  FFT (RADIX_2 / RADIX_4). </param>
+ CFFT_Object * CFFT_Init(int frameWidth, int cosTW, double beta, int polyDiv2,
+                         int engine)
+ {
+#ifdef DUMP_MODE
+     int i;
+     double *FFT_TW_dump;
+#endif
+
+     // -
+     CFFT_Object *fftObj = (CFFT_Object *)calloc(1, sizeof(CFFT_Object));
+
+     CFFT_InitFields(fftObj, frameWidth, cosTW, beta, polyDiv2, engine);
+     CFFT_InitTables(fftObj);
+
+     //     ...
+
+#ifdef DUMP_MODE
+
+     mkdir(DUMP_NAME);
+
+     //      (  -  re  im)
+     FFT_TW_dump = (double *)calloc(fftObj->NN, sizeof(double));
+     for(i = 0; i < fftObj->NN; ++i)
+     {
+         FFT_TW_dump[i] = fftObj->FFT_TW[i >> 1];
+     }
+
+     DumpInt(fftObj->FFT_P,     fftObj->NN,     DUMP_NAME, "FFT_P.int32");
+     DumpInt(fftObj->FFT_PP,    fftObj->NNPoly, DUMP_NAME, "FFT_PP.int32");
+     DumpDouble(FFT_TW_dump,    fftObj->NN,     DUMP_NAME, "FFT_TW.double");
+
+     SAFE_DELETE(FFT_TW_dump);
+
+#endif
+
+     //      ...
+     if(!CFFT_Inspector(fftObj))
+     {
+         //...-  .
+         CFFT_Destructor(fftObj);
+     }
+
+     //   "FFT"
+     return fftObj;
+ }
+
+ /// <summary>
+ ///   FFT   :  
+ ///  (N, , beta, )    
+ /// ,       .  
+ /// ;      
+ /// </summary>
+ /// <param name="frameWidth">  . </param>
+ /// <param name="cosTW">     (  -   ). </param>
+ /// <param name="beta">    . </param>
+ /// <param name="polyDiv2">     . </param>
+ /// <param name="engine">  ""  FFT (RADIX_2 / RADIX_4). </param>
+ /// <returns>  FFT (NULL -  ). </returns>
+ CFFT_Object * CFFT_InitShared(int frameWidth, int cosTW, double beta,
+                               int polyDiv2, int engine)
+ {
+     CFFT_Plan *plan;
+     CFFT_Object *fftObj = (CFFT_Object *)calloc(1, sizeof(CFFT_Object));
+
+     CFFT_InitFields(fftObj, frameWidth, cosTW, beta, polyDiv2, engine);
+
+     if(!CFFT_Inspector(fftObj))
+     {
+         SAFE_DELETE(fftObj);
+         return NULL;
+     }
+
+     CFFT_PlanLock();
+     plan = CFFT_PlanFind(fftObj);
+     CFFT_PlanUnlock();
+
+     if(plan != NULL)
+     {
+         CFFT_PlanAttach(fftObj, plan);
+         return fftObj;
+     }
+
+     //   :    ...
+     CFFT_InitTables(fftObj);
+
+     CFFT_PlanLock();
+
+     //...,        ,  
+     plan = CFFT_PlanFind(fftObj);
+
+     if(plan == NULL)
+     {
+         plan = (CFFT_Plan *)calloc(1, sizeof(CFFT_Plan));
+
+         plan->N       = fftObj->N;
+         plan->CosTW   = fftObj->CosTW;
+         plan->Beta    = fftObj->Beta;
+         plan->PolyDiv = fftObj->PolyDiv;
+         plan->FFT_P   = fftObj->FFT_P;
+         plan->FFT_PP  = fftObj->FFT_PP;
+         plan->FFT_TW  = fftObj->FFT_TW;
+         plan->FFT_WD  = fftObj->FFT_WD;
+         plan->FFT_WR  = fftObj->FFT_WR;
+         plan->Refs    = 1;
+         plan->Next    = CFFT_PlanCache;
+         CFFT_PlanCache = plan;
+         fftObj->Plan   = plan;
+
+         CFFT_PlanUnlock();
+
+     } else
+     {
+         CFFT_PlanUnlock();
+         CFFT_PlanAttach(fftObj, plan);
+     }
+
+     return fftObj;
+ }
+
+ /// <summary>
+ ///     (FNV-1a  32- )
+ /// </summary>
+ /// <param name="data">  . </param>
+ /// <param name="size">   (,  4). </param>
+ /// <returns>  . </returns>
+ unsigned int CFFT_Checksum(void *data, int size)
+ {
+     int i;
+     unsigned int *words = (unsigned int *)data;
+     unsigned int hash   = 2166136261U;
+
+     for(i = 0; i < (size >> 2); ++i)
+     {
+         hash = (hash ^ words[i]) * 16777619U;
+     }
+
+     return hash;
+ }
+
+ /// <summary>
+ ///     :   (
+ ///   SIMD_ALIGN)
+ /// </summary>
+ /// <param name="header">   . </param>
+ /// <param name="fftObj">  FFT,    . </param>
+ void CFFT_PlanFileLayout(CFFT_PlanFileHeader *header, CFFT_Object *fftObj)
+ {
+     memset(header, 0x00, sizeof(CFFT_PlanFileHeader));
+     memcpy(header->Magic, PLAN_FILE_MAGIC, sizeof(header->Magic));
+     header->Version    = PLAN_FILE_VERSION;
+     header->HeaderSize = sizeof(CFFT_PlanFileHeader);
+     header->N          = fftObj->N;
+     header->CosTW      = fftObj->CosTW;
+     header->Beta       = fftObj->Beta;
+     header->PolyDiv    = fftObj->PolyDiv;
+     header->NNPoly     = fftObj->NNPoly;
+
+     header->Offset_P  = SIMD_ALIGN_UP(header->HeaderSize);
+     header->Offset_PP = SIMD_ALIGN_UP(header->Offset_P  + (fftObj->NN     * sizeof(int)));
+     header->Offset_TW = SIMD_ALIGN_UP(header->Offset_PP + (fftObj->NNPoly * sizeof(int)));
+     header->Offset_WD = SIMD_ALIGN_UP(header->Offset_TW + (fftObj->N  * sizeof(double)));
+     header->Offset_WR = SIMD_ALIGN_UP(header->Offset_WD + (fftObj->NN * sizeof(double)));
+     header->FileSize  = SIMD_ALIGN_UP(header->Offset_WR + (fftObj->NN * sizeof(double)));
+ }
+
+ /// <summary>
+ ///    FFT    (  
+ /// CFFT_InitMapped  )
+ /// </summary>
+ /// <param name="fftObj">  FFT,    . </param>
+ /// <param name="dirName">   (NULL - ). </param>
+ /// <param name="fileName">   . </param>
+ /// <returns>   ? </returns>
+ bool CFFT_PlanSave(CFFT_Object *fftObj, char *dirName, char *fileName)
+ {
+     CFFT_PlanFileHeader header;
+     unsigned char *image;
+     FILE *f;
+     bool isOK;
+
+     //    (  PERMUTE_INPLACE  FFT_P  )
+     if((fftObj->FFT_P  == NULL) || (fftObj->FFT_PP == NULL) ||
+        (fftObj->FFT_TW == NULL) || (fftObj->FFT_WD == NULL) ||
+        (fftObj->FFT_WR == NULL))
+     {
+         return FALSE;
+     }
+
+     //      -   
+     //    ,     
+     CFFT_PlanFileLayout(&header, fftObj);
+     image = (unsigned char *)calloc(header.FileSize, 1);
+
+     if(image == NULL)
+     {
+         return FALSE;
+     }
+
+     memcpy(image + header.Offset_P,  fftObj->FFT_P,  fftObj->NN     * sizeof(int));
+     memcpy(image + header.Offset_PP, fftObj->FFT_PP, fftObj->NNPoly * sizeof(int));
+     memcpy(image + header.Offset_TW, fftObj->FFT_TW, fftObj->N  * sizeof(double));
+     memcpy(image + header.Offset_WD, fftObj->FFT_WD, fftObj->NN * sizeof(double));
+     memcpy(image + header.Offset_WR, fftObj->FFT_WR, fftObj->NN * sizeof(double));
+
+     header.Checksum = CFFT_Checksum(image + header.HeaderSize,
+                                     header.FileSize - header.HeaderSize);
+     memcpy(image, &header, sizeof(CFFT_PlanFileHeader));
+
+     f = GetStreamPointer(dirName, fileName, TRUE);
+
+     if(f == NULL)
+     {
+         SAFE_DELETE(image);
+         return FALSE;
+     }
+
+     isOK = (fwrite(image, header.FileSize, 1, f) == 1);
+     isOK = (fclose(f) == 0) && isOK;
+     SAFE_DELETE(image);
+
+     return isOK;
+ }
+
+ /// <summary>
+ ///   FFT   :     
+ ///  ,      
+ /// (   ).      -
+ ///     ( ..  CFFT_InitShared)
+ ///   
+ /// </summary>
+ /// <param name="dirName">   (NULL - ). </param>
+ /// <param name="fileName">   . </param>
+ /// <param name="engine">  ""  FFT (RADIX_2 / RADIX_4). </param>
+ /// <param name="verify">    ? </param>
+ /// <returns>  FFT (NULL -    ). </returns>
+ CFFT_Object * CFFT_InitMapped(char *dirName, char *fileName, int engine,
+                               bool verify)
+ {
+     char path[MAX_PATH];
+     HANDLE file, mapping;
+     unsigned char *view;
+     CFFT_PlanFileHeader *header, expected;
+     CFFT_Object *fftObj;
+     CFFT_Plan *plan;
+     int polyDiv2, fileSize;
+
+     GetFullPath(path, dirName, fileName);
+
+     file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL,
+                        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+     if(file == INVALID_HANDLE_VALUE)
+     {
+         return NULL;
+     }
+
+     fileSize = (int)GetFileSize(file, NULL);
+     mapping  = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+     view     = (mapping != NULL) ?
+                (unsigned char *)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) :
+                NULL;
+     header   = (CFFT_PlanFileHeader *)view;
+     fftObj   = NULL;
+
+     //  : , , ...
+     if((view != NULL) && (fileSize >= (int)sizeof(CFFT_PlanFileHeader)) &&
+        (memcmp(header->Magic, PLAN_FILE_MAGIC, sizeof(header->Magic)) == 0) &&
+        (header->Version    == PLAN_FILE_VERSION) &&
+        (header->HeaderSize == sizeof(CFFT_PlanFileHeader)) &&
+        (header->PolyDiv    >  0))
+     {
+         polyDiv2 = 0;
+
+         while((1 << polyDiv2) < header->PolyDiv)
+         {
+             ++polyDiv2;
+         }
+
+         fftObj = (CFFT_Object *)calloc(1, sizeof(CFFT_Object));
+         CFFT_InitFields(fftObj, header->N, header->CosTW, header->Beta,
+                         polyDiv2, engine);
+
+         //...  (   )...
+         CFFT_PlanFileLayout(&expected, fftObj);
+
+         if((!CFFT_Inspector(fftObj)) ||
+            (fftObj->N         != header->N)         ||
+            (fftObj->PolyDiv   != header->PolyDiv)   ||
+            (expected.FileSize != header->FileSize)  ||
+            (expected.FileSize >  fileSize)          ||
+            (memcmp(&expected.Offset_P, &header->Offset_P,
+                    5 * sizeof(int)) != 0))
+         {
+             SAFE_DELETE(fftObj);
+         }
+
+         //...  
+         if((fftObj != NULL) && verify &&
+            (CFFT_Checksum(view + header->HeaderSize,
+                           header->FileSize - header->HeaderSize) !=
+             header->Checksum))
+         {
+             SAFE_DELETE(fftObj);
+         }
+     }
+
+     if(fftObj == NULL)
+     {
+         if(view != NULL)
+         {
+             UnmapViewOfFile(view);
+         }
+
+         if(mapping != NULL)
+         {
+             CloseHandle(mapping);
+         }
+
+         CloseHandle(file);
+
+         return NULL;
+     }
+
+     CFFT_PlanLock();
+
+     //       -   
+     plan = CFFT_PlanFind(fftObj);
+
+     if(plan == NULL)
+     {
+         plan = (CFFT_Plan *)calloc(1, sizeof(CFFT_Plan));
+
+         plan->N         = fftObj->N;
+         plan->CosTW     = fftObj->CosTW;
+         plan->Beta      = fftObj->Beta;
+         plan->PolyDiv   = fftObj->PolyDiv;
+         plan->FFT_P     = (int    *)(view + header->Offset_P);
+         plan->FFT_PP    = (int    *)(view + header->Offset_PP);
+         plan->FFT_TW    = (double *)(view + header->Offset_TW);
+         plan->FFT_WD    = (double *)(view + header->Offset_WD);
+         plan->FFT_WR    = (double *)(view + header->Offset_WR);
+         plan->MapFile   = (void *)file;
+         plan->MapHandle = (void *)mapping;
+         plan->MapView   = (void *)view;
+         plan->Refs      = 1;
+         plan->Next      = CFFT_PlanCache;
+         CFFT_PlanCache  = plan;
+
+         CFFT_PlanUnlock();
+
+     } else
+     {
+         CFFT_PlanUnlock();
+
+         UnmapViewOfFile(view);
+         CloseHandle(mapping);
+         CloseHandle(file);
+     }
+
+     CFFT_PlanAttach(fftObj, plan);
+
+     return fftObj;
+ }
+
+ /// <summary>
+ ///   FFT
+ /// </summary>
+ /// <param name="frameWidth">  . </param>
+ /// <param name="cosTW">    . </param>
+ /// <param name="polyDiv2">     . </param>
+ CFFT_Object * CFFT_Constructor_Cosine(int frameWidth, int cosTW, int polyDiv2)
+ {
+     //   "FFT"
+     return CFFT_Init(frameWidth, cosTW, MAX_KAISER_BETA, polyDiv2,
+                      DEFAULT_FFT_ENGINE);
+ }
+
+ /// <summary>
+ ///   FFT
+ /// </summary>
+ /// <param name="frameWidth">  . </param>
+ /// <param name="beta">    . </param>
+ /// <param name="polyDiv2">     . </param>
+ CFFT_Object * CFFT_Constructor_Kaiser(int frameWidth, double beta, int polyDiv2)
+ {
+     //   "FFT"
+     return CFFT_Init(frameWidth, NONE, beta, polyDiv2,
+                      DEFAULT_FFT_ENGINE);
+ }
+
+ /// <summary>
+ ///    ""     -
+ ///  (       , 
+ ///     ;   
+ ///      - SIMD-  )
+ /// </summary>
+ /// <param name="FFT_T">   (re + im). </param>
+ /// <param name="n">     . </param>
+ /// <param name="frames">  . </param>
+ /// <param name="stride">    (- ). </param>
+ /// <param name="direction">   (TRUE - ).
+ /// </param>
+ /// <param name="fftObj">  FFT,    . </param>
+ void CFFT_TransformFlatBatch(double *FFT_T, int n, int frames, int stride,
+                              bool direction, CFFT_Object *fftObj)
+ {
+     int h, c, len, chunks;
+     double *W;
+
+     W = direction ? fftObj->FFT_WD : fftObj->FFT_WR;
+     h = 1;
+
+     //       ( ""
+     //     )
+     len    = (stride == (n << 1)) ? (n * frames) : n;
+     chunks = (stride == (n << 1)) ? 1 : frames;
+
+     //    4 (     )...
+     if(fftObj->Engine == RADIX_4)
+     {
+         for(; (h << 2) <= n; h <<= 2)
+         {
+             for(c = 0; c < chunks; ++c)
+             {
+                 fftObj->Radix4Stage(FFT_T + (c * stride), len, h, W,
+                                     direction, 0, h);
+             }
+         }
+     }
+
+     //...     2
+     for(; h < n; h <<= 1)
+     {
+         for(c = 0; c < chunks; ++c)
+         {
+             fftObj->Radix2Stage(FFT_T + (c * stride), len, h, W + (h << 1),
+                                 0, h);
+         }
+     }
+ }
+
+ /// <summary>
+ ///    ""    - 
+ /// (     )
+ /// </summary>
+ /// <param name="FFT_T">   (re + im). </param>
+ /// <param name="n">     . </param>
+ /// <param name="direction">   (TRUE - ).
+ /// </param>
+ /// <param name="fftObj">  FFT,    . </param>
+ void CFFT_TransformFlat(double *FFT_T, int n, bool direction,
+                         CFFT_Object *fftObj)
+ {
+     CFFT_TransformFlatBatch(FFT_T, n, 1, n << 1, direction, fftObj);
+ }
+
+ /// <summary>
+ ///  (, "cache-oblivious")   "":
+ ///     -FFT   , 
+ ///  ,        
+ /// </summary>
+ /// <param name="FFT_T">   (re + im). </param>
+ /// <param name="n">     . </param>
+ /// <param name="direction">   (TRUE - ).
+ /// </param>
+ /// <param name="fftObj">  FFT,    . </param>
+ void CFFT_TransformBlocked(double *FFT_T, int n, bool direction,
+                            CFFT_Object *fftObj)
+ {
+     int q;
+     double *W;
+
+     //     -   
+     if(n <= fftObj->BlockSize)
+     {
+         CFFT_TransformFlat(FFT_T, n, direction, fftObj);
+         return;
+     }
+
+     W = direction ? fftObj->FFT_WD : fftObj->FFT_WR;
+
+     if(fftObj->Engine == RADIX_4)
+     {
+         //   -FFT +     4
+         q = n >> 2;
+         CFFT_TransformBlocked(FFT_T,              q, direction, fftObj);
+         CFFT_TransformBlocked(FFT_T + (q << 1),   q, direction, fftObj);
+         CFFT_TransformBlocked(FFT_T + (q << 2),   q, direction, fftObj);
+         CFFT_TransformBlocked(FFT_T + (q * 6),    q, direction, fftObj);
+         fftObj->Radix4Stage(FFT_T, n, q, W, direction, 0, q);
+
+     } else
+     {
+         //   -FFT +     2
+         q = n >> 1;
+         CFFT_TransformBlocked(FFT_T,              q, direction, fftObj);
+         CFFT_TransformBlocked(FFT_T + (q << 1),   q, direction, fftObj);
+         fftObj->Radix2Stage(FFT_T, n, q, W + (q << 1), 0, q);
+     }
+ }
+
+ /// <summary>
+ ///    ""   
+ /// (   -  )
+ /// </summary>
+ /// <param name="FFT_T">   (re + im). </param>
+ /// <param name="n">     . </param>
+ /// <param name="direction">   (TRUE - ).
+ /// </param>
+ /// <param name="fftObj">  FFT,    . </param>
+ void CFFT_TransformSerial(double *FFT_T, int n, bool direction,
+                           CFFT_Object *fftObj)
+ {
+     if(n >= fftObj->BlockN)
+     {
+         CFFT_TransformBlocked(FFT_T, n, direction, fftObj);
+
+     } else
+     {
+         CFFT_TransformFlat(FFT_T, n, direction, fftObj);
+     }
+ }
+
+ //---------------------------------------------
+ //-    
+ //---------------------------------------------
+ typedef struct
+ {
+     CFFT_Object *fftObj;    //  FFT
+     double      *FFT_T;     //   (re + im)
+     double      *FFT_S;     //   ( )
+     double      *FFT_TW;    //   (NULL -  )
+     int         *FFT_P;     //  
+     int          n;         // -   (-  
+                             //   )
+     int          m;         //   -FFT ()
+     bool         direction; //  
+     double       mult;      //  
+
+ } CFFT_TaskCtx;
+
+ /// <summary>
+ ///  :  -FFT (  )
+ /// </summary>
+ void CFFT_SubFFTTask(void *ctx, int part, int parts)
+ {
+     CFFT_TaskCtx *task = (CFFT_TaskCtx *)ctx;
+     int s;
+
+     for(s = part; s < (task->n / task->m); s += parts)
+     {
+         CFFT_TransformSerial(task->FFT_T + ((s * task->m) << 1), task->m,
+                              task->direction, task->fftObj);
+     }
+ }
+
+ /// <summary>
+ ///  :     -FFT.  
+ ///  h >= m      
+ ///    m,      
+ ///  [r0, r1)      
+ /// </summary>
+ void CFFT_TopStagesTask(void *ctx, int part, int parts)
+ {
+     CFFT_TaskCtx *task = (CFFT_TaskCtx *)ctx;
+     CFFT_Object  *fftObj = task->fftObj;
+     int h, c, r0, r1, L, n, m;
+     double *W;
+
+     n = task->n;
+     m = task->m;
+
+     //    8  (  SIMD-)
+     r0 = ((m / parts) * part) & ~7;
+     r1 = (part == (parts - 1)) ? m : (((m / parts) * (part + 1)) & ~7);
+
+     if(r0 >= r1)
+     {
+         return;
+     }
+
+     W = task->direction ? fftObj->FFT_WD : fftObj->FFT_WR;
+
+     // -   radix-2
+     for(L = 0, h = m; h < n; h <<= 1)
+     {
+         ++L;
+     }
+
+     h = m;
+
+     //     "" RADIX_4    radix-2
+     if((fftObj->Engine != RADIX_4) || (L & 1))
+     {
+         for(c = 0; c < h; c += m)
+         {
+             fftObj->Radix2Stage(task->FFT_T, n, h, W + (h << 1), c + r0, c + r1);
+         }
+
+         h <<= 1;
+     }
+
+     while(h < n)
+     {
+         if(fftObj->Engine == RADIX_4)
+         {
+             for(c = 0; c < h; c += m)
+             {
+                 fftObj->Radix4Stage(task->FFT_T, n, h, W, task->direction,
+                                     c + r0, c + r1);
+             }
+
+             h <<= 2;
+
+         } else
+         {
+             for(c = 0; c < h; c += m)
+             {
+                 fftObj->Radix2Stage(task->FFT_T, n, h, W + (h << 1),
+                                     c + r0, c + r1);
+             }
+
+             h <<= 1;
+         }
+     }
+ }
+
+ /// <summary>
+ ///     "":  -FFT
+ ///    ,    
+ ///      
+ /// </summary>
+ /// <param name="FFT_T">   (re + im). </param>
+ /// <param name="n">     . </param>
+ /// <param name="direction">   (TRUE - ).
+ /// </param>
+ /// <param name="fftObj">  FFT,    . </param>
+ void CFFT_TransformParallel(double *FFT_T, int n, bool direction,
+                             CFFT_Object *fftObj)
+ {
+     int S;
+     CFFT_TaskCtx task;
+
+     // - -FFT:      ( RADIX_4 -  4-)
+     for(S = 1; S < (fftObj->Pool->Threads << 1); S <<= 1);
+
+     if((fftObj->Engine == RADIX_4) && (S & 0x2AAAAAAA))
+     {
+         S <<= 1;
+     }
+
+     // -FFT   -    
+     if((n / S) < MIN_FRAME_WIDTH)
+     {
+         CFFT_TransformSerial(FFT_T, n, direction, fftObj);
+         return;
+     }
+
+     task.fftObj    = fftObj;
+     task.FFT_T     = FFT_T;
+     task.n         = n;
+     task.m         = n / S;
+     task.direction = direction;
+
+     CFFT_PoolRun(fftObj->Pool, CFFT_SubFFTTask,    &task);
+     CFFT_PoolRun(fftObj->Pool, CFFT_TopStagesTask, &task);
+ }
+
+ /// <summary>
+ ///    ""    - 
+ /// (   -   /   )
+ /// </summary>
+ /// <param name="FFT_T">   (re + im). </param>
+ /// <param name="n">     . </param>
+ /// <param name="direction">   (TRUE - ).
+ /// </param>
+ /// <param name="fftObj">  FFT,    . </param>
+ void CFFT_Transform(double *FFT_T, int n, bool direction,
+                     CFFT_Object *fftObj)
+ {
+     if((fftObj->Pool != NULL) && (n >= fftObj->ParallelN))
+     {
+         CFFT_TransformParallel(FFT_T, n, direction, fftObj);
+
+     } else
+     {
+         CFFT_TransformSerial(FFT_T, n, direction, fftObj);
+     }
+ }
+
+ /// <summary>
+ ///  :    FFT (  )
+ /// </summary>
+ void CFFT_GatherTask(void *ctx, int part, int parts)
+ {
+     CFFT_TaskCtx *task = (CFFT_TaskCtx *)ctx;
+     int a, b;
+
+     a = ((task->n / parts) * part) & ~1;
+     b = (part == (parts - 1)) ? task->n : (((task->n / parts) * (part + 1)) & ~1);
+
+     if(task->FFT_TW != NULL)
+     {
+         task->fftObj->GatherTW(task->FFT_T + a, task->FFT_S, task->FFT_P + a,
+                                task->FFT_TW, b - a);
+     } else
+     {
+         task->fftObj->Gather(task->FFT_T + a, task->FFT_S, task->FFT_P + a,
+                              b - a);
+     }
+ }
+
+ /// <summary>
+ ///    FFT (     ),
+ ///    -   
+ /// </summary>
+ /// <param name="FFT_T">   (re + im,    FFT_S).
+ /// </param>
+ /// <param name="FFT_S">   (  ). </param>
+ /// <param name="FFT_P">   (NULL -   
+ ///     ). </param>
+ /// <param name="FFT_TW">   (NULL -  ). </param>
+ /// <param name="nn">   (re + im). </param>
+ /// <param name="fftObj">  FFT,    . </param>
+ void CFFT_ParallelGather(double *FFT_T, double *FFT_S, int *FFT_P,
+                          double *FFT_TW, int nn, CFFT_Object *fftObj)
+ {
+     CFFT_TaskCtx task;
+     int i;
+
+     //    ( PERMUTE_INPLACE  FFT_S == FFT_T):
+     //   ( )    
+     if((FFT_P == NULL) || (FFT_T == FFT_S))
+     {
+         if(FFT_TW != NULL)
+         {
+             for(i = 0; i < nn; ++i)
+             {
+                 FFT_T[i] = FFT_TW[i >> 1] * FFT_S[i];
+             }
+
+         } else if(FFT_T != FFT_S)
+         {
+             memmove(FFT_T, FFT_S, nn * sizeof(double));
+         }
+
+         if(FFT_P == NULL)
+         {
+             CFFT_SwapPairs(FFT_T, fftObj->FFT_SW, fftObj->SwapCount);
+
+         } else
+         {
+             CFFT_SwapByTable(FFT_T, FFT_P, nn);
+         }
+
+         return;
+     }
+
+     if((fftObj->Pool != NULL) && ((nn >> 1) >= fftObj->ParallelN))
+     {
+         task.fftObj = fftObj;
+         task.FFT_T  = FFT_T;
+         task.FFT_S  = FFT_S;
+         task.FFT_P  = FFT_P;
+         task.FFT_TW = FFT_TW;
+         task.n      = nn;
+         CFFT_PoolRun(fftObj->Pool, CFFT_GatherTask, &task);
+
+     } else if(FFT_TW != NULL)
+     {
+         fftObj->GatherTW(FFT_T, FFT_S, FFT_P, FFT_TW, nn);
+
+     } else
+     {
+         fftObj->Gather(FFT_T, FFT_S, FFT_P, nn);
+     }
+ }
+
+ /// <summary>
+ ///  :   (  )
+ /// </summary>
+ void CFFT_ScaleTask(void *ctx, int part, int parts)
+ {
+     CFFT_TaskCtx *task = (CFFT_TaskCtx *)ctx;
+     int a, b;
+
+     a = ((task->n / parts) * part) & ~7;
+     b = (part == (parts - 1)) ? task->n : (((task->n / parts) * (part + 1)) & ~7);
+
+     task->fftObj->Scale(task->FFT_T + a, b - a, task->mult);
+ }
+
+ /// <summary>
+ ///   (),    -
+ ///   
+ /// </summary>
+ /// <param name="FFT_T">  . </param>
+ /// <param name="nn">  . </param>
+ /// <param name="mult"> . </param>
+ /// <param name="fftObj">  FFT,    . </param>
+ void CFFT_ParallelScale(double *FFT_T, int nn, double mult,
+                         CFFT_Object *fftObj)
+ {
+     CFFT_TaskCtx task;
+
+     if((fftObj->Pool != NULL) && ((nn >> 1) >= fftObj->ParallelN))
+     {
+         task.fftObj = fftObj;
+         task.FFT_T  = FFT_T;
+         task.n      = nn;
+         task.mult   = mult;
+         CFFT_PoolRun(fftObj->Pool, CFFT_ScaleTask, &task);
+
+     } else
+     {
+         fftObj->Scale(FFT_T, nn, mult);
+     }
+ }
+
+ /// <summary>
+ ///   (WOLA)    [a, b):  
+ ///      , 
+ ///  ,       
+ /// </summary>
+ /// <param name="FFT_T">   (re + im, NNPoly , 
+ ///    ). </param>
+ /// <param name="FFT_S">   ( j   
+ /// ((first + j) mod PolyDiv) * NNPoly). </param>
+ /// <param name="first">   , 
+ ///   (0 -   ). </param>
+ /// <param name="a">    (). </param>
+ /// <param name="b"> ,      (). </param>
+ /// <param name="fftObj">  FFT,    . </param>
+ void CFFT_PolyFoldRange(double *FFT_T, double *FFT_S, int first, int a, int b,
+                         CFFT_Object *fftObj)
+ {
+     int j, k, blk, seg;
+
+     blk = fftObj->BlockSize << 1;
+
+     for(; a < b; a += blk)
+     {
+         blk = min(blk, b - a);
+
+         for(j = 0; j < fftObj->PolyDiv; ++j)
+         {
+             seg = ((first + j) & (fftObj->PolyDiv - 1)) * fftObj->NNPoly;
+             k   = j * fftObj->NNPoly;
+
+             fftObj->FoldTW(FFT_T + a, FFT_S + seg + a,
+                            fftObj->FFT_TW + ((k + a) >> 1), blk, j > 0);
+         }
+     }
+ }
+
+ //---------------------------------------------
+ //-    
+ //---------------------------------------------
+ typedef struct
+ {
+     CFFT_Object *fftObj; //  FFT
+     double      *FFT_T;  //   (re + im)
+     double      *FFT_S;  //  
+     int          first;  //  ,   
+
+ } CFFT_FoldCtx;
+
+ /// <summary>
+ ///  :   (  )
+ /// </summary>
+ void CFFT_PolyFoldTask(void *ctx, int part, int parts)
+ {
+     CFFT_FoldCtx *task = (CFFT_FoldCtx *)ctx;
+     int a, b, nn = task->fftObj->NNPoly;
+
+     a = ((nn / parts) * part) & ~1;
+     b = (part == (parts - 1)) ? nn : (((nn / parts) * (part + 1)) & ~1);
+
+     CFFT_PolyFoldRange(task->FFT_T, task->FFT_S, task->first, a, b,
+                        task->fftObj);
+ }
+
+ /// <summary>
+ ///   (WOLA)   PolyDiv   NPoly 
+ /// (   -   )
+ /// </summary>
+ /// <param name="FFT_T">   (re + im,  
+ ///    ). </param>
+ /// <param name="FFT_S">  . </param>
+ /// <param name="first">   , 
+ ///   (0 -   ). </param>
+ /// <param name="fftObj">  FFT,    . </param>
+ void CFFT_PolyFold(double *FFT_T, double *FFT_S, int first,
+                    CFFT_Object *fftObj)
+ {
+     CFFT_FoldCtx task;
+
+     if((fftObj->Pool != NULL) && (fftObj->N >= fftObj->ParallelN))
+     {
+         task.fftObj = fftObj;
+         task.FFT_T  = FFT_T;
+         task.FFT_S  = FFT_S;
+         task.first  = first;
+         CFFT_PoolRun(fftObj->Pool, CFFT_PolyFoldTask, &task);
+
+     } else
+     {
+         CFFT_PolyFoldRange(FFT_T, FFT_S, first, 0, fftObj->NNPoly, fftObj);
+     }
+ }
+
+ /// <summary>
+ ///  :  NPoly      
+ /// N  ( j - ,    j)
+ /// </summary>
+ /// <param name="FFT_T">   (NNPoly   ,
+ /// NN -  ). </param>
+ /// <param name="FFT_TW">   (N .). </param>
+ /// <param name="fftObj">  FFT,    . </param>
+ void CFFT_PolyUnfold(double *FFT_T, double *FFT_TW, CFFT_Object *fftObj)
+ {
+     int j;
+
+     //       -  
+     for(j = fftObj->PolyDiv - 1; j >= 0; --j)
+     {
+         fftObj->FoldTW(FFT_T + (j * fftObj->NNPoly), FFT_T,
+                        FFT_TW + (j * fftObj->NPoly), fftObj->NNPoly, FALSE);
+     }
+ }
+
+ /// <summary>
+ ///    FFT:   (  
+ ///    )     
+ /// </summary>
+ /// <param name="FFT_S">   
+ /// (""  ""  - ./.). </param>
+ /// <param name="FFT_S_Offset">     
+ ///   FFT_S. </param>
+ /// <param name="FFT_T">   . </param>
+ /// <param name="useTaperWindow">   ? </param>
+ /// <param name="useNorm">   1/N? </param>
+ /// <param name="direction">   (TRUE - ).
+ /// </param>
+ /// <param name="usePolyphase">   FFT? </param>
+ /// <param name="fftObj">  FFT,    . </param>
+ void CFFT_PreProcess(double *FFT_S, int FFT_S_Offset, double *FFT_T,
+                      bool useTaperWindow, bool useNorm, bool direction,
+                      bool usePolyphase, CFFT_Object *fftObj)
+ {
+     int m;
+     double mult;
+
+     //    
+     //    
+     if(direction && useTaperWindow)
+     {
+         if(!usePolyphase)
+         {
+             //  FFT
+             //  ,   
+             CFFT_ParallelGather(FFT_T, FFT_S + FFT_S_Offset, fftObj->FFT_P,
+                                 fftObj->FFT_TW, fftObj->NN, fftObj);
+         }
+         else
+         {
+             //  FFT (   ):  
+             //   FFT_T ( k   
+             // k + j * NNPoly,     ),
+             //   
+             CFFT_PolyFold(FFT_T, FFT_S + FFT_S_Offset, 0, fftObj);
+             CFFT_SwapByTable(FFT_T, fftObj->FFT_PP, fftObj->NNPoly);
+         }
+     }
+     else if((!direction) && usePolyphase)
+     {
+         //    -   NPoly 
+         CFFT_ParallelGather(FFT_T, FFT_S + FFT_S_Offset, fftObj->FFT_PP,
+                             NULL, fftObj->NNPoly, fftObj);
+     }
+     else
+     {
+         //    ...
+         //    
+         CFFT_ParallelGather(FFT_T, FFT_S + FFT_S_Offset, fftObj->FFT_P,
+                             NULL, fftObj->NN, fftObj);
+     }
+
+     //         
+     //    (   100% ). 
+     //    1/N    FFT (  N ),
+     //     M  (M = N  NPoly) 
+     //  N / M ,   ,  1 / M
+     if(!direction)
+     {
+         m    = usePolyphase ? fftObj->NPoly : fftObj->N;
+         mult = useNorm ? ((double)fftObj->N / m) : (1.0 / m);
+
+         if(mult != 1.0)
+         {
+             CFFT_ParallelScale(FFT_T, m << 1, mult, fftObj);
+         }
+     }
+ }
+
+ /// <summary>
+ ///  FFT :     
+ ///     
+ /// </summary>
+ /// <param name="FFT_T">   . </param>
+ /// <param name="useTaperWindow">   ? </param>
+ /// <param name="recoverAfterTaperWindow">  
+ ///     ? </param>
+ /// <param name="useNorm">   1/N? </param>
+ /// <param name="direction">   (TRUE - ).
+ /// </param>
+ /// <param name="usePolyphase">   FFT? </param>
+ /// <param name="fftObj">  FFT,    . </param>
+ void CFFT_PostProcess(double *FFT_T, bool useTaperWindow,
+                       bool recoverAfterTaperWindow, bool useNorm,
+                       bool direction, bool usePolyphase, CFFT_Object *fftObj)
+ {
+     int n;
+
+     //        
+     //     (   100% )
+     if(direction && useNorm)
+     {
+         n = usePolyphase ? fftObj->NNPoly : fftObj->NN;
+         CFFT_ParallelScale(FFT_T, n, 1.0 / fftObj->N, fftObj);
+     }
+
+     //  :    N    
+     // (  )     
+     if((!direction) && useTaperWindow && usePolyphase)
+     {
+         CFFT_PolyUnfold(FFT_T, recoverAfterTaperWindow ?
+                         CFFT_GetTWS(fftObj) : fftObj->FFT_TW, fftObj);
+     }
+
+     //    (      
+     // -        )
+     else if((!direction) && useTaperWindow && recoverAfterTaperWindow)
+     {
+         fftObj->ScaleTW(FFT_T, CFFT_GetTWR(fftObj), fftObj->NN);
+     }
+ }
+
+ /// <summary>
+ ///    FFT.    :
+ /// FFT_T == FFT_S + FFT_S_Offset (  
+ ///  )
+ /// </summary>
+ /// <param name="FFT_S">   
+ /// (""  ""  - ./.). </param>
+ /// <param name="FFT_S_Offset">     
+ ///   FFT_S. </param>
+ /// <param name="FFT_T">   . </param>
+ /// <param name="useTaperWindow">   ? </param>
+ /// <param name="recoverAfterTaperWindow">  
+ ///     ? </param>
+ /// <param name="useNorm">   1/N? </param>
+ /// <param name="direction">   (TRUE - ).
+ /// </param>
+ /// <param name="usePolyphase">   FFT? </param>
+ /// <param name="fftObj">  FFT,    . </param>
+ void CFFT_Process(double *FFT_S, int FFT_S_Offset, double *FFT_T,
+                   bool useTaperWindow, bool recoverAfterTaperWindow,
+                   bool useNorm, bool direction, bool usePolyphase,
+                   CFFT_Object *fftObj)
+ {
+     int n;
+
+     CFFT_PreProcess(FFT_S, FFT_S_Offset, FFT_T, useTaperWindow, useNorm,
+                     direction, usePolyphase, fftObj);
+
+     // FFT Routine
+     n = usePolyphase ? fftObj->NNPoly : fftObj->NN;
+     CFFT_Transform(FFT_T, n >> 1, direction, fftObj);
+
+     CFFT_PostProcess(FFT_T, useTaperWindow, recoverAfterTaperWindow, useNorm,
+                      direction, usePolyphase, fftObj);
+ }
+
+ /// <summary>
+ ///   :   
+ /// </summary>
+ /// <param name="fftObj">  FFT,    . </param>
+ void CFFT_PolyStreamReset(CFFT_Object *fftObj)
+ {
+     if(fftObj->FFT_PS != NULL)
+     {
+         memset(fftObj->FFT_PS, 0, fftObj->NN * sizeof(double));
+     }
+
+     fftObj->PolyPos = 0;
+ }
+
+ /// <summary>
+ ///   FFT   NPoly :  
+ ///        ,   PolyDiv
+ ///      . 
+ ///   CFFT_Process ( , )  , 
+ ///  ;      - 
+ /// </summary>
+ /// <param name="FFT_S">   
+ /// (""  ""  - ./.). </param>
+ /// <param name="FFT_S_Offset">    (NPoly )
+ ///    FFT_S. </param>
+ /// <param name="FFT_T">    (NPoly ). </param>
+ /// <param name="useNorm">   1/N? </param>
+ /// <param name="fftObj">  FFT,    . </param>
+ void CFFT_ProcessPolyStream(double *FFT_S, int FFT_S_Offset, double *FFT_T,
+                             bool useNorm, CFFT_Object *fftObj)
+ {
+     if(fftObj->FFT_PS == NULL)
+     {
+         fftObj->FFT_PS  = (double *)calloc(fftObj->NN, sizeof(double));
+         fftObj->PolyPos = 0;
+     }
+
+     memcpy(fftObj->FFT_PS + (fftObj->PolyPos * fftObj->NNPoly),
+            FFT_S + FFT_S_Offset, fftObj->NNPoly * sizeof(double));
+
+     //        
+     fftObj->PolyPos = (fftObj->PolyPos + 1) & (fftObj->PolyDiv - 1);
+
+     CFFT_PolyFold(FFT_T, fftObj->FFT_PS, fftObj->PolyPos, fftObj);
+     CFFT_SwapByTable(FFT_T, fftObj->FFT_PP, fftObj->NNPoly);
+
+     // FFT Routine
+     CFFT_Transform(FFT_T, fftObj->NPoly, DIRECT, fftObj);
+
+     CFFT_PostProcess(FFT_T, TRUE, FALSE, useNorm, DIRECT, TRUE, fftObj);
+ }
+
+ /// <summary>
+ ///    (),    DFT 
+ ///  FFT:     N  , 
+ /// FFT -  N * log2(N)
+ /// </summary>
+ /// <param name="fftObj">  FFT,    . </param>
+ /// <returns>   (0 -  DFT  ). </returns>
+ int CFFT_SlideMaxHop(CFFT_Object *fftObj)
+ {
+     if(fftObj->SlideHop != 0)
+     {
+         return max(fftObj->SlideHop, 0);
+     }
+
+     return Log2Int(fftObj->N) / SLIDING_DFT_HOP_DIV;
+ }
+
+ /// <summary>
+ ///    DFT:     -
+ ///      FFT ( 
+ ///  )
+ /// </summary>
+ /// <param name="fftObj">  FFT,    . </param>
+ /// <returns>   (). </returns>
+ int CFFT_SlidePeriod(CFFT_Object *fftObj)
+ {
+     return (fftObj->SlideReanchor > 0) ?
+            fftObj->SlideReanchor : (SLIDING_DFT_REANCHOR * fftObj->N);
+ }
+
+ /// <summary>
+ ///    DFT     ?  
+ ///    ,     
+ /// ;      
+ /// </summary>
+ /// <param name="hop">   (). </param>
+ /// <param name="useTaperWindow">   ? </param>
+ /// <param name="usePolyphase">   FFT? </param>
+ /// <param name="fftObj">  FFT,    . </param>
+ /// <returns>  DFT ? </returns>
+ bool CFFT_SlideAllowed(int hop, bool useTaperWindow, bool usePolyphase,
+                        CFFT_Object *fftObj)
+ {
+     return (hop >= 1) && (hop <= CFFT_SlideMaxHop(fftObj)) &&
+            (!usePolyphase) && ((!useTaperWindow) || (fftObj->CosTW != NONE));
+ }
+
+ /// <summary>
+ ///   DFT:   CFFT_ProcessSliding 
+ ///  FFT (      )
+ /// </summary>
+ /// <param name="fftObj">  FFT,    . </param>
+ void CFFT_SlideReset(CFFT_Object *fftObj)
+ {
+     fftObj->SlideSrc   = NULL;
+     fftObj->SlideCount = 0;
+ }
+
+ /// <summary>
+ ///   DFT
+ /// </summary>
+ /// <param name="fftObj">  FFT,    . </param>
+ /// <param name="maxHop">    (; 0 - 
+ ///   N, < 0 -  DFT ). </param>
+ /// <param name="reanchor">   (; 0 -  ,
+ /// SLIDING_DFT_REANCHOR ). </param>
+ void CFFT_SetSliding(CFFT_Object *fftObj, int maxHop, int reanchor)
+ {
+     fftObj->SlideHop      = maxHop;
+     fftObj->SlideReanchor = max(reanchor, 0);
+
+     CFFT_SlideReset(fftObj);
+ }
+
+ /// <summary>
+ ///      DFT:   
+ ///     . 
+ /// (a0 - a1 * cos(x) + a2 * cos(2x) - a3 * cos(3x)) / ad  
+ ///  N,    -     
+ /// (a0, -a1 / 2, a2 / 2, -a3 / 2) / ad,   
+ /// </summary>
+ /// <param name="FFT_SD">   DFT. </param>
+ /// <param name="FFT_T">    ( 
+ ///  FFT_SD). </param>
+ /// <param name="useTaperWindow">   ? </param>
+ /// <param name="useNorm">   1/N? </param>
+ /// <param name="fftObj">  FFT,    . </param>
+ void CFFT_SlideOutput(double *FFT_SD, double *FFT_T, bool useTaperWindow,
+                       bool useNorm, CFFT_Object *fftObj)
+ {
+     int nn;
+     double a[5], c[4], mult;
+
+     nn   = fftObj->NN;
+     mult = useNorm ? (1.0 / fftObj->N) : 1.0;
+
+     if(!useTaperWindow)
+     {
+         memcpy(FFT_T, FFT_SD, nn * sizeof(double));
+
+         if(useNorm)
+         {
+             fftObj->Scale(FFT_T, nn, mult);
+         }
+
+         return;
+     }
+
+     CFFT_CosineTerms(fftObj->CosTW, a);
+
+     c[0] =  mult * a[0] / a[4];
+     c[1] = -mult * a[1] / (2.0 * a[4]);
+     c[2] =  mult * a[2] / (2.0 * a[4]);
+     c[3] = -mult * a[3] / (2.0 * a[4]);
+
+     fftObj->SlideTW(FFT_T, FFT_SD, c, nn, 0, nn);
+ }
+
+ /// <summary>
+ ///  FFT ,   :  
+ ///  (CFFT_SlideMaxHop)     
+ /// DFT  O(N * )   FFT;  CFFT_SlidePeriod ,
+ ///    ,     
+ ///   FFT.      
+ ///   ( - CFFT_SlideReset).   
+ ///   -  CFFT_Process
+ /// </summary>
+ /// <param name="FFT_S">   
+ /// (""  ""  - ./.). </param>
+ /// <param name="FFT_S_Offset">     
+ ///   FFT_S. </param>
+ /// <param name="FFT_T">    (
+ ///    ). </param>
+ /// <param name="useTaperWindow">   ? </param>
+ /// <param name="useNorm">   1/N? </param>
+ /// <param name="fftObj">  FFT,    . </param>
+ void CFFT_ProcessSliding(double *FFT_S, int FFT_S_Offset, double *FFT_T,
+                          bool useTaperWindow, bool useNorm,
+                          CFFT_Object *fftObj)
+ {
+     int delta, hop;
+
+     if(!CFFT_SlideAllowed(1, useTaperWindow, FALSE, fftObj))
+     {
+         fftObj->SlideSrc = NULL;
+         CFFT_Process(FFT_S, FFT_S_Offset, FFT_T, useTaperWindow, FALSE,
+                      useNorm, DIRECT, FALSE, fftObj);
+
+         return;
+     }
+
+     if(fftObj->FFT_SD == NULL)
+     {
+         fftObj->FFT_SD   = (double *)calloc(fftObj->NN, sizeof(double));
+         fftObj->SlideSrc = NULL;
+     }
+
+     delta = FFT_S_Offset - fftObj->SlideOffset;
+     hop   = delta >> 1;
+
+     if((fftObj->SlideSrc == FFT_S) && ((delta & 1) == 0) && (hop >= 0) &&
+        (hop <= CFFT_SlideMaxHop(fftObj)) &&
+        ((fftObj->SlideCount + hop) <= CFFT_SlidePeriod(fftObj)))
+     {
+         //     [ , + hop), 
+         //    
+         fftObj->SlideDFT(fftObj->FFT_SD, CFFT_GetSDW(fftObj),
+                          FFT_S + fftObj->SlideOffset,
+                          FFT_S + fftObj->SlideOffset + fftObj->NN,
+                          hop, fftObj->NN);
+
+         fftObj->SlideCount += hop;
+
+     } else
+     {
+         // :      -  FFT
+         CFFT_Process(FFT_S, FFT_S_Offset, fftObj->FFT_SD, FALSE, FALSE,
+                      FALSE, DIRECT, FALSE, fftObj);
+
+         fftObj->SlideCount = 0;
+     }
+
+     fftObj->SlideSrc    = FFT_S;
+     fftObj->SlideOffset = FFT_S_Offset;
+
+     CFFT_SlideOutput(fftObj->FFT_SD, FFT_T, useTaperWindow, useNorm, fftObj);
+ }
+
+ /// <summary>
+ ///   PCM  
+ /// </summary>
+ /// <param name="PCM">   PCM (  ). </param>
+ /// <param name="format">   (PCM_Format). </param>
+ /// <param name="idx">  . </param>
+ /// <returns>  . </returns>
+ double CFFT_PCMSample(void *PCM, int format, int idx)
+ {
+     unsigned char *b;
+
+     switch(format)
+     {
+         case PCM_INT16:   return (double)((short *)PCM)[idx];
+         case PCM_INT32:   return (double)((int   *)PCM)[idx];
+         case PCM_FLOAT32: return (double)((float *)PCM)[idx];
+         default:
+         case PCM_INT24:
+         {
+             //   -  ,   8    
+             b = (unsigned char *)PCM + (3 * idx);
+             return (double)((int)(((unsigned int)b[0] <<  8) |
+                                   ((unsigned int)b[1] << 16) |
+                                   ((unsigned int)b[2] << 24)) >> 8);
+         }
+     }
+ }
+
+ //   PCM    double,  
+ //   (sample -      p)
+ #define PCM_GATHER(sample) \
+         if(FFT_TW != NULL) \
+         { \
+             for(i = a; i < b; ++i) \
+             { \
+                 p = (FFT_P != NULL) ? FFT_P[i] : i; \
+                 FFT_T[i] = FFT_TW[p >> 1] * scale * (double)(sample); \
+             } \
+         } else \
+         { \
+             for(i = a; i < b; ++i) \
+             { \
+                 p = (FFT_P != NULL) ? FFT_P[i] : i; \
+                 FFT_T[i] = scale * (double)(sample); \
+             } \
+         }
+
+ /// <summary>
+ ///   PCM  FFT   : 
+ /// ,     
+ /// </summary>
+ /// <param name="FFT_T">   (re + im). </param>
+ /// <param name="PCM">   PCM (  ). </param>
+ /// <param name="format">   (PCM_Format). </param>
+ /// <param name="FFT_P">   (NULL -  ). </param>
+ /// <param name="FFT_TW">   (NULL -  ). </param>
+ /// <param name="scale">   . </param>
+ /// <param name="a">   . </param>
+ /// <param name="b"> ,     . </param>
+ void CFFT_GatherPCM(double *FFT_T, void *PCM, int format, int *FFT_P,
+                     double *FFT_TW, double scale, int a, int b)
+ {
+     int i, p;
+     short *s16 = (short *)PCM;
+     int   *s32 = (int   *)PCM;
+     float *f32 = (float *)PCM;
+
+     switch(format)
+     {
+         case PCM_INT16:   { PCM_GATHER(s16[p]); break; }
+         case PCM_INT32:   { PCM_GATHER(s32[p]); break; }
+         case PCM_FLOAT32: { PCM_GATHER(f32[p]); break; }
+         default:
+         case PCM_INT24:   { PCM_GATHER(CFFT_PCMSample(PCM, PCM_INT24, p)); break; }
+     }
+ }
+
+ //   (WOLA)  PCM    double 
+ //  :     
+ //   (sample -      p)
+ #define PCM_POLY_FOLD(sample) \
+         for(a = 0; a < nnPoly; a += blk) \
+         { \
+             blk = min(blk, nnPoly - a); \
+             for(i = a; i < (a + blk); ++i) \
+             { \
+                 p = i; \
+                 FFT_T[i] = FFT_TW[p >> 1] * (double)(sample); \
+             } \
+             for(j = 1; j < polyDiv; ++j) \
+             { \
+                 for(i = a; i < (a + blk); ++i) \
+                 { \
+                     p = (j * nnPoly) + i; \
+                     FFT_T[i] += FFT_TW[p >> 1] * (double)(sample); \
+                 } \
+             } \
+         }
+
+ /// <summary>
+ ///   (WOLA)  PCM   FFT:  
+ ///    - ,    -  
+ ///   ( -   ,  )
+ /// </summary>
+ /// <param name="FFT_T">   (re + im, NNPoly ). </param>
+ /// <param name="PCM">   PCM (  ). </param>
+ /// <param name="format">   (PCM_Format). </param>
+ /// <param name="FFT_TW">  . </param>
+ /// <param name="nnPoly">    (re + im). </param>
+ /// <param name="polyDiv">  . </param>
+ /// <param name="blk">    (). </param>
+ void CFFT_PolyFoldPCM(double *FFT_T, void *PCM, int format, double *FFT_TW,
+                       int nnPoly, int polyDiv, int blk)
+ {
+     int a, i, j, p;
+     short *s16 = (short *)PCM;
+     int   *s32 = (int   *)PCM;
+     float *f32 = (float *)PCM;
+
+     switch(format)
+     {
+         case PCM_INT16:   { PCM_POLY_FOLD(s16[p]); break; }
+         case PCM_INT32:   { PCM_POLY_FOLD(s32[p]); break; }
+         case PCM_FLOAT32: { PCM_POLY_FOLD(f32[p]); break; }
+         default:
+         case PCM_INT24:   { PCM_POLY_FOLD(CFFT_PCMSample(PCM, PCM_INT24, p)); break; }
+     }
+ }
+
+ //---------------------------------------------
+ //-    PCM
+ //---------------------------------------------
+ typedef struct
+ {
+     double *FFT_T;  //   (re + im)
+     void   *PCM;    //   PCM (  )
+     int     format; //  
+     int    *FFT_P;  //  
+     double *FFT_TW; //   (NULL -  )
+     double  scale;  //   
+     int     nn;     //   (re + im)
+
+ } CFFT_PCMCtx;
+
+ /// <summary>
+ ///  :   PCM (  )
+ /// </summary>
+ void CFFT_GatherPCMTask(void *ctx, int part, int parts)
+ {
+     CFFT_PCMCtx *task = (CFFT_PCMCtx *)ctx;
+     int a, b;
+
+     a = ((task->nn / parts) * part) & ~1;
+     b = (part == (parts - 1)) ? task->nn : (((task->nn / parts) * (part + 1)) & ~1);
+
+     CFFT_GatherPCM(task->FFT_T, task->PCM, task->format, task->FFT_P,
+                    task->FFT_TW, task->scale, a, b);
+ }
+
+ /// <summary>
+ ///   FFT    PCM (,
+ /// ""  ""  - ./.):  ,
+ /// ,    - 
+ ///   ,    double
+ /// </summary>
+ /// <param name="PCM">   PCM. </param>
+ /// <param name="format">   (PCM_Format). </param>
+ /// <param name="PCM_Offset">      
+ ///  (). </param>
+ /// <param name="scale">    (,
+ /// 1.0 / 32768   16- ). </param>
+ /// <param name="FFT_T">   . </param>
+ /// <param name="useTaperWindow">   ? </param>
+ /// <param name="useNorm">   1/N? </param>
+ /// <param name="usePolyphase">   FFT? </param>
+ /// <param name="fftObj">  FFT,    . </param>
+ void CFFT_ProcessPCM(void *PCM, int format, int PCM_Offset, double scale,
+                      double *FFT_T, bool useTaperWindow, bool useNorm,
+                      bool usePolyphase, CFFT_Object *fftObj)
+ {
+     int n;
+     CFFT_PCMCtx task;
+
+     //  
+     PCM = (unsigned char *)PCM + (PCM_Offset * ((format == PCM_INT16) ? 2 :
+                                                 (format == PCM_INT24) ? 3 : 4));
+
+     if(useTaperWindow && usePolyphase)
+     {
+         //  FFT:      ,
+         //     (  CFFT_PreProcess)
+         CFFT_PolyFoldPCM(FFT_T, PCM, format, fftObj->FFT_TW, fftObj->NNPoly,
+                          fftObj->PolyDiv, fftObj->BlockSize << 1);
+         CFFT_SwapByTable(FFT_T, fftObj->FFT_PP, fftObj->NNPoly);
+
+         if(scale != 1.0)
+         {
+             fftObj->Scale(FFT_T, fftObj->NNPoly, scale);
+         }
+     }
+     else
+     {
+         task.FFT_T  = FFT_T;
+         task.PCM    = PCM;
+         task.format = format;
+         task.FFT_P  = fftObj->FFT_P;
+         task.FFT_TW = useTaperWindow ? fftObj->FFT_TW : NULL;
+         task.scale  = scale;
+         task.nn     = fftObj->NN;
+
+         if((fftObj->Pool != NULL) && (fftObj->N >= fftObj->ParallelN))
+         {
+             CFFT_PoolRun(fftObj->Pool, CFFT_GatherPCMTask, &task);
+
+         } else
+         {
+             CFFT_GatherPCM(FFT_T, PCM, format, task.FFT_P, task.FFT_TW,
+                            scale, 0, task.nn);
+         }
+
+         //    (    )
+         if(task.FFT_P == NULL)
+         {
+             CFFT_SwapPairs(FFT_T, fftObj->FFT_SW, fftObj->SwapCount);
+         }
+     }
+
+     // FFT Routine
+     n = usePolyphase ? fftObj->NNPoly : fftObj->NN;
+     CFFT_Transform(FFT_T, n >> 1, DIRECT, fftObj);
+
+     CFFT_PostProcess(FFT_T, useTaperWindow, FALSE, useNorm, DIRECT,
+                      usePolyphase, fftObj);
+ }
+
+ //---------------------------------------------
+ //-   FFT
+ //---------------------------------------------
+ typedef struct
+ {
+     CFFT_Object *fftObj;        //  FFT
+     double      *FFT_S;         //   
+     int         *FFT_S_Offsets; //   (NULL -  )
+     int          FFT_S_Stride;  //     
+     double      *FFT_T;         //   
+     int          FFT_T_Stride;  //     
+     int          frames;        //  
+     bool         useTaperWindow, recoverAfterTaperWindow, useNorm,
+                  direction, usePolyphase;
+
+ } CFFT_BatchCtx;
+
+ /// <summary>
+ ///  FFT   [f0, f1)
+ /// </summary>
+ /// <param name="task">   FFT. </param>
+ /// <param name="f0">   . </param>
+ /// <param name="f1"> ,     . </param>
+ void CFFT_BatchRange(CFFT_BatchCtx *task, int f0, int f1)
+ {
+     CFFT_Object *fftObj = task->fftObj;
+     int f, g, n, group;
+     double *FFT_T;
+
+     //  FFT
+     n = task->usePolyphase ? fftObj->NPoly : fftObj->N;
+
+     //    ,     ( 
+     //  FFT    )
+     group = ((n < fftObj->BlockN) && (n < fftObj->BlockSize)) ?
+             (fftObj->BlockSize / n) : 1;
+
+     for(g = f0; g < f1; g += group)
+     {
+         group = min(group, f1 - g);
+
+         for(f = g; f < (g + group); ++f)
+         {
+             CFFT_PreProcess(task->FFT_S, (task->FFT_S_Offsets != NULL) ?
+                             task->FFT_S_Offsets[f] : (f * task->FFT_S_Stride),
+                             task->FFT_T + (f * task->FFT_T_Stride),
+                             task->useTaperWindow, task->useNorm,
+                             task->direction, task->usePolyphase, fftObj);
+         }
+
+         FFT_T = task->FFT_T + (g * task->FFT_T_Stride);
+
+         if(group > 1)
+         {
+             CFFT_TransformFlatBatch(FFT_T, n, group, task->FFT_T_Stride,
+                                     task->direction, fftObj);
+         } else
+         {
+             CFFT_Transform(FFT_T, n, task->direction, fftObj);
+         }
+
+         for(f = g; f < (g + group); ++f)
+         {
+             CFFT_PostProcess(task->FFT_T + (f * task->FFT_T_Stride),
+                              task->useTaperWindow,
+                              task->recoverAfterTaperWindow, task->useNorm,
+                              task->direction, task->usePolyphase, fftObj);
+         }
+     }
+ }
+
+ /// <summary>
+ ///  :  FFT (   )
+ /// </summary>
+ void CFFT_BatchTask(void *ctx, int part, int parts)
+ {
+     CFFT_BatchCtx *task = (CFFT_BatchCtx *)ctx;
+
+     CFFT_BatchRange(task, (task->frames * part) / parts,
+                     (task->frames * (part + 1)) / parts);
+ }
+
+ /// <summary>
+ ///   FFT:      
+ /// (       ,
+ ///     -     )
+ /// </summary>
+ /// <param name="FFT_S">   
+ /// (""  ""  - ./.). </param>
+ /// <param name="FFT_S_Offsets">      FFT_S
+ /// (NULL -  k    k * FFT_S_Stride). </param>
+ /// <param name="FFT_S_Stride">     . </param>
+ /// <param name="FFT_T">   . </param>
+ /// <param name="FFT_T_Stride">      ( 
+ /// 2N,   FFT      -   2N / PolyDiv;
+ ///   -    ). </param>
+ /// <param name="frames">  . </param>
+ /// <param name="useTaperWindow">   ? </param>
+ /// <param name="recoverAfterTaperWindow">  
+ ///     ? </param>
+ /// <param name="useNorm">   1/N? </param>
+ /// <param name="direction">   (TRUE - ).
+ /// </param>
+ /// <param name="usePolyphase">   FFT? </param>
+ /// <param name="fftObj">  FFT,    . </param>
+ void CFFT_ProcessBatch(double *FFT_S, int *FFT_S_Offsets, int FFT_S_Stride,
+                        double *FFT_T, int FFT_T_Stride, int frames,
+                        bool useTaperWindow, bool recoverAfterTaperWindow,
+                        bool useNorm, bool direction, bool usePolyphase,
+                        CFFT_Object *fftObj)
+ {
+     CFFT_BatchCtx task;
+     int n;
+
+     task.fftObj                  = fftObj;
+     task.FFT_S                   = FFT_S;
+     task.FFT_S_Offsets           = FFT_S_Offsets;
+     task.FFT_S_Stride            = FFT_S_Stride;
+     task.FFT_T                   = FFT_T;
+     task.FFT_T_Stride            = FFT_T_Stride;
+     task.frames                  = frames;
+     task.useTaperWindow          = useTaperWindow;
+     task.recoverAfterTaperWindow = recoverAfterTaperWindow;
+     task.useNorm                 = useNorm;
+     task.direction               = direction;
+     task.usePolyphase            = usePolyphase;
+
+     //  FFT
+     n = usePolyphase ? fftObj->NPoly : fftObj->N;
+
+     //   ( )    
+     if((!direction) && useTaperWindow && recoverAfterTaperWindow)
+     {
+         if(usePolyphase)
+         {
+             CFFT_GetTWS(fftObj);
+
+         } else
+         {
+             CFFT_GetTWR(fftObj);
+         }
+     }
+
+     //      ( 
+     //  CFFT_Transform)
+     if((fftObj->Pool != NULL) && (frames > 1) && (n < fftObj->ParallelN))
+     {
+         CFFT_PoolRun(fftObj->Pool, CFFT_BatchTask, &task);
+
+     } else
+     {
+         CFFT_BatchRange(&task, 0, frames);
+     }
+ }
+
+ /// <summary>
+ ///   Z N / 2-  FFT (
+ ///     -  re / im)   X
+ /// N-  FFT: X[k] = E[k] + W^k * O[k], 
+ /// E = (Z[k] + Z*[N/2 - k]) / 2, O = -i * (Z[k] - Z*[N/2 - k]) / 2.
+ ///  - X[0]...X[N/2 - 1],  X[N/2] 
+ ///     X[0] (   )
+ /// </summary>
+ /// <param name="FFT_T">   (N , re + im). </param>
+ /// <param name="fftObj">  FFT,    . </param>
+ void CFFT_RealSplit(double *FFT_T, CFFT_Object *fftObj)
+ {
+     int k, h;
+     double *W, ar, ai, br, bi, er, ei, qr, qi, tr, ti, wr, wi;
+
+     h = fftObj->N >> 1;
+     W = fftObj->FFT_WD + (h << 1); // W[k] = exp(-i * 2 * PI * k / N)
+
+     // ""    N/2
+     ar = FFT_T[0];
+     ai = FFT_T[1];
+     FFT_T[0] = ar + ai;
+     FFT_T[1] = ar - ai;
+
+     //  k  N/2 - k   ( )
+     for(k = 1; k <= (h >> 1); ++k)
+     {
+         ar = FFT_T[(k << 1) + 0];
+         ai = FFT_T[(k << 1) + 1];
+         br = FFT_T[((h - k) << 1) + 0];
+         bi = FFT_T[((h - k) << 1) + 1];
+         wr = W[(k << 1) + 0];
+         wi = W[(k << 1) + 1];
+
+         er =  0.5 * (ar + br);
+         ei =  0.5 * (ai - bi);
+         qr =  0.5 * (ai + bi);
+         qi = -0.5 * (ar - br);
+
+         tr = (wr * qr) - (wi * qi);
+         ti = (wr * qi) + (wi * qr);
+
+         // X[N/2 - k] = (E[k] - W^k * O[k])*
+         FFT_T[((h - k) << 1) + 0] = er - tr;
+         FFT_T[((h - k) << 1) + 1] = ti - ei;
+         FFT_T[(k << 1) + 0]       = er + tr;
+         FFT_T[(k << 1) + 1]       = ei + ti;
+     }
+ }
+
+ /// <summary>
+ ///   N-  FFT  
+ /// N / 2-  FFT (,  CFFT_RealSplit):
+ ///   Z ()    -
+ ///  (  PERMUTE_INPLACE   FFT_S == FFT_T -  
+ ///      )
+ /// </summary>
+ /// <param name="FFT_S">   FFT ( CFFT_RealSplit).
+ /// </param>
+ /// <param name="FFT_T">   (N , re + im). </param>
+ /// <param name="fftObj">  FFT,    . </param>
+ void CFFT_RealJoin(double *FFT_S, double *FFT_T, CFFT_Object *fftObj)
+ {
+     int k, h, p, q;
+     double *W, ar, ai, br, bi, er, ei, dr, di, qr, qi, wr, wi;
+     bool inPlace;
+
+     h = fftObj->N >> 1;
+     W = fftObj->FFT_WD + (h << 1);
+
+     //         
+     inPlace = (fftObj->FFT_P == NULL) || (FFT_S == FFT_T);
+
+     // Z[0] (-   - )
+     ar = FFT_S[0];
+     ai = FFT_S[1];
+     FFT_T[0] = ar + ai;
+     FFT_T[1] = ar - ai;
+
+     for(k = 1; k <= (h >> 1); ++k)
+     {
+         ar = FFT_S[(k << 1) + 0];
+         ai = FFT_S[(k << 1) + 1];
+         br = FFT_S[((h - k) << 1) + 0];
+         bi = FFT_S[((h - k) << 1) + 1];
+         wr = W[(k << 1) + 0];
+         wi = W[(k << 1) + 1];
+
+         // 2E = X[k] + X*[N/2 - k], 2O = (W^k)* * (X[k] - X*[N/2 - k])
+         er = ar + br;
+         ei = ai - bi;
+         dr = ar - br;
+         di = ai + bi;
+         qr = (wr * dr) + (wi * di);
+         qi = (wr * di) - (wi * dr);
+
+         // -   k N/2- FFT  
+         //   2k N- (FFT_P[4k] = 2 * bitrev(k))
+         if(!inPlace)
+         {
+             p = fftObj->FFT_P[k << 2];
+             q = fftObj->FFT_P[(h - k) << 2];
+
+         } else
+         {
+             p = k << 1;
+             q = (h - k) << 1;
+         }
+
+         // Z[N/2 - k] = E* + i * O*, Z[k] = E + i * O
+         FFT_T[q + 0] = er + qi;
+         FFT_T[q + 1] = qr - ei;
+         FFT_T[p + 0] = er - qi;
+         FFT_T[p + 1] = ei + qr;
+     }
+
+     if(inPlace)
+     {
+         CFFT_BitReverse(FFT_T, h);
+     }
+ }
+
+ /// <summary>
+ ///  FFT (-): N  
+ ///  N / 2-  FFT   
+ /// .  : N  FFT_S -> N / 2   FFT_T
+ /// ( CFFT_RealSplit);  :     ->
+ /// N .  FFT_T == FFT_S + FFT_S_Offset
+ /// </summary>
+ /// <param name="FFT_S">    (N ). </param>
+ /// <param name="FFT_S_Offset">     
+ ///   FFT_S. </param>
+ /// <param name="FFT_T">   (N ). </param>
+ /// <param name="useTaperWindow">   ? </param>
+ /// <param name="recoverAfterTaperWindow">  
+ ///     ? </param>
+ /// <param name="useNorm">   1/N? </param>
+ /// <param name="direction">   (TRUE - ).
+ /// </param>
+ /// <param name="fftObj">  FFT,    . </param>
+ void CFFT_RealProcess(double *FFT_S, int FFT_S_Offset, double *FFT_T,
+                       bool useTaperWindow, bool recoverAfterTaperWindow,
+                       bool useNorm, bool direction, CFFT_Object *fftObj)
+ {
+     int i, h, p, q;
+     int *FFT_P = fftObj->FFT_P;
+     double *FFT_TW = fftObj->FFT_TW, *FFT_TWR;
+
+     h = fftObj->N >> 1;
+     FFT_S += FFT_S_Offset;
+
+     //      
+     if(FFT_T == FFT_S)
+     {
+         FFT_P = NULL;
+     }
+
+     if(direction)
+     {
+         //   -  :   
+         //   FFT_P (  :  j - FFT_TW[j])
+         for(i = 0; (FFT_P != NULL) && (i < h); ++i)
+         {
+             p = FFT_P[(i << 2) + 0];
+             q = FFT_P[(i << 2) + 1];
+
+             if(useTaperWindow)
+             {
+                 FFT_T[(i << 1) + 0] = FFT_S[p] * FFT_TW[p];
+                 FFT_T[(i << 1) + 1] = FFT_S[q] * FFT_TW[q];
+
+             } else
+             {
+                 FFT_T[(i << 1) + 0] = FFT_S[p];
+                 FFT_T[(i << 1) + 1] = FFT_S[q];
+             }
+         }
+
+         //   :   ( ) 
+         // -  N / 2 
+         if(FFT_P == NULL)
+         {
+             for(i = 0; i < fftObj->N; ++i)
+             {
+                 FFT_T[i] = useTaperWindow ? (FFT_S[i] * FFT_TW[i]) :
+                                             FFT_S[i];
+             }
+
+             CFFT_BitReverse(FFT_T, h);
+         }
+
+         CFFT_Transform(FFT_T, h, direction, fftObj);
+         CFFT_RealSplit(FFT_T, fftObj);
+
+         if(useNorm)
+         {
+             CFFT_ParallelScale(FFT_T, fftObj->N, 1.0 / fftObj->N, fftObj);
+         }
+
+     } else
+     {
+         CFFT_RealJoin(FFT_S, FFT_T, fftObj);
+
+         if(!useNorm)
+         {
+             CFFT_ParallelScale(FFT_T, fftObj->N, 1.0 / fftObj->N, fftObj);
+         }
+
+         CFFT_Transform(FFT_T, h, direction, fftObj);
+
+         if(useTaperWindow && recoverAfterTaperWindow)
+         {
+             FFT_TWR = CFFT_GetTWR(fftObj);
+
+             for(i = 0; i < fftObj->N; ++i)
+             {
+                 FFT_T[i] *= FFT_TWR[i];
+             }
+         }
+     }
+ }
+
+ /// <summary>
+ /// , ,        
+ /// (   )
+ /// </summary>
+ /// <param name="L"> ""  ( , re + im). </param>
+ /// <param name="R"> ""  ( , re + im). </param>
+ /// <param name="i">   . </param>
+ /// <param name="k"> -   (  EXPLORE_CHUNK). </param>
+ /// <param name="MagL">  "" . </param>
+ /// <param name="MagR">  "" . </param>
+ /// <param name="ACH"> . </param>
+ /// <param name="ArgL">  "" . </param>
+ /// <param name="ArgR">  "" . </param>
+ /// <param name="PhaseLR">    . </param>
+ /// <param name="fftObj">  FFT,    . </param>
+ void CFFT_ExploreChannels(double *L, double *R, int i, int k, double *MagL,
+                           double *MagR, double *ACH, double *ArgL,
+                           double *ArgR, double *PhaseLR, CFFT_Object *fftObj)
+ {
+     int j;
+     bool needMag, needArg;
+     double *mL, *mR, *aL, *aR;
+     double magL[EXPLORE_CHUNK], magR[EXPLORE_CHUNK],
+            argL[EXPLORE_CHUNK], argR[EXPLORE_CHUNK];
+
+     needMag = (MagL != NULL) || (MagR != NULL) || (ACH     != NULL);
+     needArg = (ArgL != NULL) || (ArgR != NULL) || (PhaseLR != NULL);
+
+     if(needMag)
+     {
+         mL = (MagL != NULL) ? (MagL + i) : magL;
+         mR = (MagR != NULL) ? (MagR + i) : magR;
+
+         fftObj->Magnitude(L, k, mL);
+         fftObj->Magnitude(R, k, mR);
+
+         for(j = 0; j < k; ++j)
+         {
+             mL[j] *= 0.5;
+             mR[j] *= 0.5;
+         }
+
+         if(ACH != NULL)
+         {
+             for(j = 0; j < k; ++j)
+             {
+                 ACH[i + j] = mR[j] / ((mL[j] == 0) ? FLOAT_MIN : mL[j]);
+             }
+         }
+     }
+
+     if(needArg)
+     {
+         aL = (ArgL != NULL) ? (ArgL + i) : argL;
+         aR = (ArgR != NULL) ? (ArgR + i) : argR;
+
+         fftObj->Argument(L, k, aL);
+         fftObj->Argument(R, k, aR);
+
+         if(PhaseLR != NULL)
+         {
+             for(j = 0; j < k; ++j)
+             {
+                 PhaseLR[i + j] = PhaseNorm(aR[j] - aL[j]);
+             }
+         }
+     }
+ }
+
+ /// <summary>
+ ///  ""  ""     [i0, i1).
+ ///   :    
+ /// ,       
+ ///  (  NULL     )
+ /// </summary>
+ /// <param name="FFT_T">   . </param>
+ /// <param name="MagL">  "" . </param>
+ /// <param name="MagR">  "" . </param>
+ /// <param name="ACH"> . </param>
+ /// <param name="ArgL">  "" . </param>
+ /// <param name="ArgR">  "" . </param>
+ /// <param name="PhaseLR">    . </param>
+ /// <param name="N">  FFT. </param>
+ /// <param name="mult">   (   1
+ ///      FFT_T). </param>
+ /// <param name="i0">    (  1). </param>
+ /// <param name="i1"> ,     . </param>
+ /// <param name="fftObj">  FFT,    . </param>
+ void CFFT_ExploreRange(double *FFT_T, double *MagL, double *MagR, double *ACH,
+                        double *ArgL, double *ArgR, double *PhaseLR,
+                        int N, double mult, int i0, int i1, CFFT_Object *fftObj)
+ {
+     int i, j, k;
+     double *T_i, *T_N_i;
+     double L[EXPLORE_CHUNK << 1], R[EXPLORE_CHUNK << 1];
+
+     for(i = i0; i < i1; i += k)
+     {
+         k = min(EXPLORE_CHUNK, i1 - i);
+
+         //     -  
+         //     
+         if(mult != 1.0)
+         {
+             for(j = i; j < (i + k); ++j)
+             {
+                 FFT_T[(j << 1) + 0]       *= mult;
+                 FFT_T[(j << 1) + 1]       *= mult;
+                 FFT_T[((N - j) << 1) + 0] *= mult;
+                 FFT_T[((N - j) << 1) + 1] *= mult;
+             }
+         }
+
+         //  : L = (lx, ly), R = (rx, ry)
+         for(j = 0; j < k; ++j)
+         {
+             T_i   = FFT_T + ((i + j) << 1);
+             T_N_i = FFT_T + ((N - i - j) << 1);
+
+             L[(j << 1) + 0] = T_i[0]   + T_N_i[0];
+             L[(j << 1) + 1] = T_i[1]   - T_N_i[1];
+             R[(j << 1) + 0] = T_i[1]   + T_N_i[1];
+             R[(j << 1) + 1] = T_N_i[0] - T_i[0];
+         }
+
+         CFFT_ExploreChannels(L, R, i, k, MagL, MagR, ACH, ArgL, ArgR,
+                              PhaseLR, fftObj);
+     }
+ }
+
+ //---------------------------------------------
+ //-    
+ //---------------------------------------------
+ typedef struct
+ {
+     CFFT_Object *fftObj;
+     double *FFT_T, *MagL, *MagR, *ACH, *ArgL, *ArgR, *PhaseLR;
+     double  mult;
+     int     N;
+
+ } CFFT_ExploreCtx;
+
+ /// <summary>
+ ///  :   (   )
+ /// </summary>
+ void CFFT_ExploreTask(void *ctx, int part, int parts)
+ {
+     CFFT_ExploreCtx *task = (CFFT_ExploreCtx *)ctx;
+     int i0, i1, K;
+
+     K  = (task->N >> 1) - 1;
+     i0 = 1 + ((K / parts) * part);
+     i1 = (part == (parts - 1)) ? (task->N >> 1) : (1 + ((K / parts) * (part + 1)));
+
+     CFFT_ExploreRange(task->FFT_T, task->MagL, task->MagR, task->ACH,
+                       task->ArgL, task->ArgR, task->PhaseLR, task->N,
+                       task->mult, i0, i1, task->fftObj);
+ }
+
+ /// <summary>
+ ///  ""  ""   
+ ///     : ("" -
+ ///    , "" -  )
+ /// </summary>
+ /// <param name="FFT_T">   . </param>
+ /// <param name="MagL">  "" . </param>
+ /// <param name="MagR">  "" . </param>
+ /// <param name="ACH">  (  ""   
+ /// "" -  "" / ""). </param>
+ /// <param name="ArgL">  "" . </param>
+ /// <param name="ArgR">  "" . </param>
+ /// <param name="PhaseLR">     ("" 
+ /// ""). </param>
+ /// <param name="usePolyphase">   FFT? </param>
+ /// <param name="mult">   (1 -  ,
+ ///       FFT_T).
+ /// </param>
+ /// <param name="fftObj">  FFT,    . </param>
+ void CFFT_ExploreScaled(double *FFT_T, double *MagL, double *MagR,
+                         double *ACH, double *ArgL, double *ArgR,
+                         double *PhaseLR, bool usePolyphase, double mult,
+                         CFFT_Object *fftObj)
+ {
+     int N;
+     double magL, magR;
+     CFFT_ExploreCtx task;
+
+     //   FFT
+     N = usePolyphase ? fftObj->NPoly : fftObj->N;
+
+     //        -  
+     if(mult != 1.0)
+     {
+         FFT_T[0] *= mult;
+         FFT_T[1] *= mult;
+         FFT_T[N + 0] *= mult;
+         FFT_T[N + 1] *= mult;
+     }
+
+     //       
+     // ("" )
+     magL = FFT_T[0];
+     magR = FFT_T[1];
+          
+     if(MagL    != NULL) MagL[0]    = magL;
+     if(MagR    != NULL) MagR[0]    = magR;
+     if(ACH     != NULL) ACH[0]     = magR / ((magL == 0) ? FLOAT_MIN : magL);
+     if(ArgL    != NULL) ArgL[0]    = M_PI;
+     if(ArgR    != NULL) ArgR[0]    = M_PI;
+     if(PhaseLR != NULL) PhaseLR[0] = 0;
+
+     //     (   -  
+     // )
+     if((fftObj->Pool != NULL) && (N >= fftObj->ParallelN))
+     {
+         task.fftObj  = fftObj;
+         task.FFT_T   = FFT_T;
+         task.MagL    = MagL;
+         task.MagR    = MagR;
+         task.ACH     = ACH;
+         task.ArgL    = ArgL;
+         task.ArgR    = ArgR;
+         task.PhaseLR = PhaseLR;
+         task.mult    = mult;
+         task.N       = N;
+         CFFT_PoolRun(fftObj->Pool, CFFT_ExploreTask, &task);
+
+     } else
+     {
+         CFFT_ExploreRange(FFT_T, MagL, MagR, ACH, ArgL, ArgR, PhaseLR,
+                           N, mult, 1, N >> 1, fftObj);
+     }
+ }
+
+ /// <summary>
+ ///  ""  "" : ("" -
+ ///    , "" -  )
+ /// </summary>
+ /// <param name="FFT_T">   . </param>
+ /// <param name="MagL">  "" . </param>
+ /// <param name="MagR">  "" . </param>
+ /// <param name="ACH">  (  ""   
+ /// "" -  "" / ""). </param>
+ /// <param name="ArgL">  "" . </param>
+ /// <param name="ArgR">  "" . </param>
+ /// <param name="PhaseLR">     ("" 
+ /// ""). </param>
+ /// <param name="usePolyphase">   FFT? </param>
+ /// <param name="fftObj">  FFT,    . </param>
+ void CFFT_Explore(double *FFT_T, double *MagL, double *MagR, double *ACH,
+                   double *ArgL, double *ArgR, double *PhaseLR, bool usePolyphase,
+                   CFFT_Object *fftObj)
+ {
+     CFFT_ExploreScaled(FFT_T, MagL, MagR, ACH, ArgL, ArgR, PhaseLR,
+                        usePolyphase, 1.0, fftObj);
+ }
+
+ /// <summary>
+ ///   FFT,    : 
+ /// 1/N     ,    , 
+ ///    ""     (FFT_T 
+ ///     CFFT_Process)
+ /// </summary>
+ /// <param name="FFT_S">   
+ /// (""  ""  - ./.). </param>
+ /// <param name="FFT_S_Offset">     
+ ///   FFT_S. </param>
+ /// <param name="FFT_T">   . </param>
+ /// <param name="MagL">  "" . </param>
+ /// <param name="MagR">  "" . </param>
+ /// <param name="ACH"> . </param>
+ /// <param name="ArgL">  "" . </param>
+ /// <param name="ArgR">  "" . </param>
+ /// <param name="PhaseLR">    . </param>
+ /// <param name="useTaperWindow">   ? </param>
+ /// <param name="useNorm">   1/N? </param>
+ /// <param name="usePolyphase">   FFT? </param>
+ /// <param name="fftObj">  FFT,    . </param>
+ void CFFT_ProcessExplore(double *FFT_S, int FFT_S_Offset, double *FFT_T,
+                          double *MagL, double *MagR, double *ACH,
+                          double *ArgL, double *ArgR, double *PhaseLR,
+                          bool useTaperWindow, bool useNorm, bool usePolyphase,
+                          CFFT_Object *fftObj)
+ {
+     int n;
+
+     CFFT_PreProcess(FFT_S, FFT_S_Offset, FFT_T, useTaperWindow, useNorm,
+                     DIRECT, usePolyphase, fftObj);
+
+     // FFT Routine
+     n = usePolyphase ? fftObj->NNPoly : fftObj->NN;
+     CFFT_Transform(FFT_T, n >> 1, DIRECT, fftObj);
+
+     CFFT_ExploreScaled(FFT_T, MagL, MagR, ACH, ArgL, ArgR, PhaseLR,
+                        usePolyphase, useNorm ? (1.0 / fftObj->N) : 1.0,
+                        fftObj);
+ }
+
+ /// <summary>
+ ///    k (  GOERTZEL_LANES)  
+ ///  ;   -   
+ /// exp(+j * 2 * PI * i / N): -4 * sin^2(w / 2) = -2 * sin^2(w) / (1 + cos(w))
+ /// ( cos(w) < 0 -    w - PI)
+ /// </summary>
+ /// <param name="FFT_S">    (N ). </param>
+ /// <param name="FFT_TW">   (NULL -  ). </param>
+ /// <param name="i0">  . </param>
+ /// <param name="k"> - . </param>
+ /// <param name="mult">  . </param>
+ /// <param name="L">  ""  (k  re + im). </param>
+ /// <param name="R">  ""  (k  re + im). </param>
+ /// <param name="fftObj">  FFT,    . </param>
+ void CFFT_GoertzelBins(double *FFT_S, double *FFT_TW, int i0, int k,
+                        double mult, double *L, double *R, CFFT_Object *fftObj)
+ {
+     int b, i;
+     double *W, cw, sw, half, *st;
+     double sign[GOERTZEL_LANES], lambda[GOERTZEL_LANES],
+            state[GOERTZEL_LANES << 2];
+
+     W = CFFT_GetSDW(fftObj);
+
+     //     
+     for(b = 0; b < GOERTZEL_LANES; ++b)
+     {
+         i  = i0 + min(b, k - 1);
+         cw = W[(i << 1) + 0];
+         sw = W[(i << 1) + 1];
+
+         sign[b]   = (cw >= 0) ? 1.0 : -1.0;
+         lambda[b] = -2.0 * sw * sw / (1.0 + fabs(cw));
+     }
+
+     fftObj->Goertzel(FFT_S, FFT_TW, fftObj->N, sign, lambda, state);
+
+     // X = e^(jw) * s[N - 1] - s[N - 2]   d  s
+     // (sin(w - PI) = -sin(w))
+     for(b = 0; b < k; ++b)
+     {
+         st   = state + (b << 2);
+         sw   = sign[b] * W[((i0 + b) << 1) + 1];
+         half = 0.5 * lambda[b];
+
+         L[(b << 1) + 0] = mult * (st[0] + (half * st[2]));
+         L[(b << 1) + 1] = mult * (sw * st[2]);
+         R[(b << 1) + 0] = mult * (st[1] + (half * st[3]));
+         R[(b << 1) + 1] = mult * (sw * st[3]);
+     }
+ }
+
+ /// <summary>
+ ///    FFT:    q  
+ /// (k0 .. k0 + q - 1  k1 .. k1 + q - 1)   
+ /// O(N * log2(q)).     (n = i + p * m, p = N / q)
+ ///  p   q ;  q- FFT ( )
+ ///       :
+ /// X[k] =   i exp(-j * 2 * PI * k * i / N) * Y_i[k mod q]
+ /// </summary>
+ /// <param name="FFT_S">    (N ). </param>
+ /// <param name="FFT_TW">   (NULL -  ). </param>
+ /// <param name="k0">     (  N). </param>
+ /// <param name="k1">     (  N). </param>
+ /// <param name="q">   ( ,   N). </param>
+ /// <param name="Z0">    (q  re + im). </param>
+ /// <param name="Z1">    (q  re + im). </param>
+ /// <param name="work">   (NN + 8 * q ). </param>
+ /// <param name="fftObj">  FFT,    . </param>
+ void CFFT_PrunedBands(double *FFT_S, double *FFT_TW, int k0, int k1, int q,
+                       double *Z0, double *Z1, double *work,
+                       CFFT_Object *fftObj)
+ {
+     int i, i0, i1, j, m, n, p, r, rv, b, band, k;
+     unsigned int idx;
+     double *W, *Y, *Z, *acc, *st, xr, xi, ar, ai, wr, wi;
+
+     W   = CFFT_GetSDW(fftObj);
+     p   = fftObj->N / q;
+     b   = min(p, 8);
+     acc = work + fftObj->NN;
+     st  = acc + (q << 2);
+
+     //   - ,   b
+     //  (  -   ); bitrev_q(m)
+     //  -  (  FFT_P,  
+     //  PERMUTE_INPLACE)
+     for(i0 = 0; i0 < p; i0 += b)
+     {
+         for(m = 0, rv = 0; m < q; ++m)
+         {
+             r = rv << 1;
+
+             for(i = i0; i < (i0 + b); ++i)
+             {
+                 n  = i + (p * m);
+                 xr = FFT_S[(n << 1) + 0];
+                 xi = FFT_S[(n << 1) + 1];
+
+                 if(FFT_TW != NULL)
+                 {
+                     xr *= FFT_TW[n];
+                     xi *= FFT_TW[n];
+                 }
+
+                 Y = work + (i * (q << 1));
+                 Y[r + 0] = xr;
+                 Y[r + 1] = xi;
+             }
+
+             // -  rv
+             for(k = q >> 1; (k > 0) && (k <= rv); k >>= 1)
+             {
+                 rv -= k;
+             }
+
+             rv += k;
+         }
+     }
+
+     CFFT_TransformFlatBatch(work, q, p, q << 1, DIRECT, fftObj);
+
+     //    : exp(-j * 2 * PI * k / N)
+     for(band = 0; band < 2; ++band)
+     {
+         for(j = 0; j < q; ++j)
+         {
+             idx = ((unsigned int)(band ? k1 : k0) + j) & (fftObj->N - 1);
+             st[(((band * q) + j) << 1) + 0] =  W[(idx << 1) + 0];
+             st[(((band * q) + j) << 1) + 1] = -W[(idx << 1) + 1];
+         }
+     }
+
+     memset(Z0, 0, (q << 1) * sizeof(double));
+     memset(Z1, 0, (q << 1) * sizeof(double));
+
+     //    PRUNED_FFT_BLOCK :   -
+     //    (    ), 
+     //    - ,  
+     for(i0 = 0; i0 < p; i0 += PRUNED_FFT_BLOCK)
+     {
+         i1 = min(i0 + PRUNED_FFT_BLOCK, p);
+
+         memset(acc, 0, (q << 2) * sizeof(double));
+
+         for(i = i1 - 1; i >= i0; --i)
+         {
+             Y = work + (i * (q << 1));
+
+             for(band = 0; band < 2; ++band)
+             {
+                 k = band ? k1 : k0;
+
+                 for(j = 0; j < q; ++j)
+                 {
+                     r  = ((k + j) & (q - 1)) << 1;
+                     n  = ((band * q) + j) << 1;
+                     ar = acc[n + 0];
+                     ai = acc[n + 1];
+
+                     acc[n + 0] = (ar * st[n + 0]) - (ai * st[n + 1]) + Y[r + 0];
+                     acc[n + 1] = (ar * st[n + 1]) + (ai * st[n + 0]) + Y[r + 1];
+                 }
+             }
+         }
+
+         for(band = 0; band < 2; ++band)
+         {
+             Z = band ? Z1 : Z0;
+             k = band ? k1 : k0;
+
+             for(j = 0; j < q; ++j)
+             {
+                 idx = (((unsigned int)k + j) * (unsigned int)i0) &
+                       (fftObj->N - 1);
+                 wr  =  W[(idx << 1) + 0];
+                 wi  = -W[(idx << 1) + 1];
+                 n   = ((band * q) + j) << 1;
+
+                 Z[(j << 1) + 0] += (acc[n + 0] * wr) - (acc[n + 1] * wi);
+                 Z[(j << 1) + 1] += (acc[n + 0] * wi) + (acc[n + 1] * wr);
+             }
+         }
+     }
+ }
+
+ /// <summary>
+ ///    ,   (
+ ///  -   CFFT_Explore)
+ /// </summary>
+ /// <param name="L"> ""  ( , re + im). </param>
+ /// <param name="R"> ""  ( , re + im). </param>
+ /// <param name="i">   . </param>
+ /// <param name="k"> -   (  EXPLORE_CHUNK). </param>
+ /// <param name="MagL">  "" . </param>
+ /// <param name="MagR">  "" . </param>
+ /// <param name="ACH"> . </param>
+ /// <param name="ArgL">  "" . </param>
+ /// <param name="ArgR">  "" . </param>
+ /// <param name="PhaseLR">    . </param>
+ /// <param name="fftObj">  FFT,    . </param>
+ void CFFT_ExploreBinsChunk(double *L, double *R, int i, int k, double *MagL,
+                            double *MagR, double *ACH, double *ArgL,
+                            double *ArgR, double *PhaseLR, CFFT_Object *fftObj)
+ {
+     double magL, magR;
+
+     if(i == 0)
+     {
+         //  :  
+         magL = 0.5 * L[0];
+         magR = 0.5 * R[0];
+
+         if(MagL    != NULL) MagL[0]    = magL;
+         if(MagR    != NULL) MagR[0]    = magR;
+         if(ACH     != NULL) ACH[0]     = magR / ((magL == 0) ? FLOAT_MIN : magL);
+         if(ArgL    != NULL) ArgL[0]    = M_PI;
+         if(ArgR    != NULL) ArgR[0]    = M_PI;
+         if(PhaseLR != NULL) PhaseLR[0] = 0;
+
+         L += 2;
+         R += 2;
+         ++i;
+         --k;
+     }
+
+     if(k > 0)
+     {
+         CFFT_ExploreChannels(L, R, i, k, MagL, MagR, ACH, ArgL, ArgR,
+                              PhaseLR, fftObj);
+     }
+ }
+
+ /// <summary>
+ ///   :    
+ ///  ( -   CFFT_Explore  CFFT_Process, 
+ ///      ).   (
+ /// PRUNED_FFT_MIN_BINS ) -  ,  O(N) 
+ /// ;  -  FFT     ,
+ ///  O(N * log2()).  - N  (  );
+ ///    FFT (NN + 12 *  )  
+ ///    (CFFT_SetBuffer),     
+ ///        (  
+ ///     -   )
+ /// </summary>
+ /// <param name="FFT_S">   
+ /// (""  ""  - ./.). </param>
+ /// <param name="FFT_S_Offset">     
+ ///   FFT_S. </param>
+ /// <param name="Ranges">  :   
+ /// [L, R] (  ExactFreq),   [0, N / 2 - 1]. </param>
+ /// <param name="rangeCount"> - . </param>
+ /// <param name="MagL">  "" . </param>
+ /// <param name="MagR">  "" . </param>
+ /// <param name="ACH"> . </param>
+ /// <param name="ArgL">  "" . </param>
+ /// <param name="ArgR">  "" . </param>
+ /// <param name="PhaseLR">    . </param>
+ /// <param name="useTaperWindow">   ? </param>
+ /// <param name="useNorm">   1/N? </param>
+ /// <param name="fftObj">  FFT,    . </param>
+ void CFFT_ExploreBins(double *FFT_S, int FFT_S_Offset, int *Ranges,
+                       int rangeCount, double *MagL, double *MagR,
+                       double *ACH, double *ArgL, double *ArgR,
+                       double *PhaseLR, bool useTaperWindow, bool useNorm,
+                       CFFT_Object *fftObj)
+ {
+     int r, a, b, i, j, k, q, N2, workSize;
+     double *FFT_TW, *work, *Zb, *Zm, *T_i, *T_N_i, mult;
+     bool useBuffer;
+     double L[EXPLORE_CHUNK << 1], R[EXPLORE_CHUNK << 1];
+
+     FFT_S += FFT_S_Offset;
+     FFT_TW = useTaperWindow ? fftObj->FFT_TW : NULL;
+     mult   = useNorm ? (1.0 / fftObj->N) : 1.0;
+
+     //     ,    
+     N2 = fftObj->N >> 1;
+     useBuffer = !(CFFT_BufferOverlaps(fftObj, FFT_S,   fftObj->NN) ||
+                   CFFT_BufferOverlaps(fftObj, MagL,    N2) ||
+                   CFFT_BufferOverlaps(fftObj, MagR,    N2) ||
+                   CFFT_BufferOverlaps(fftObj, ACH,     N2) ||
+                   CFFT_BufferOverlaps(fftObj, ArgL,    N2) ||
+                   CFFT_BufferOverlaps(fftObj, ArgR,    N2) ||
+                   CFFT_BufferOverlaps(fftObj, PhaseLR, N2));
+
+     for(r = 0; r < rangeCount; ++r)
+     {
+         a = max(Ranges[(r << 1) + 0], 0);
+         b = min(Ranges[(r << 1) + 1], (fftObj->N >> 1) - 1);
+
+         if(a > b)
+         {
+             continue;
+         }
+
+         if((b - a + 1) < PRUNED_FFT_MIN_BINS)
+         {
+             for(i = a; i <= b; i += k)
+             {
+                 k = min(EXPLORE_CHUNK, b - i + 1);
+
+                 //      - 
+                 //      
+                 for(j = 0; j < k; j += GOERTZEL_LANES)
+                 {
+                     CFFT_GoertzelBins(FFT_S, FFT_TW, i + j,
+                                       min(GOERTZEL_LANES, k - j), 2.0 * mult,
+                                       L + (j << 1), R + (j << 1), fftObj);
+                 }
+
+                 CFFT_ExploreBinsChunk(L, R, i, k, MagL, MagR, ACH, ArgL,
+                                       ArgR, PhaseLR, fftObj);
+             }
+
+             continue;
+         }
+
+         //   -    
+         q = ToLowerPowerOf2(b - a + 1);
+         q = (q < (b - a + 1)) ? (q << 1) : q;
+
+         workSize = fftObj->NN + (q << 3) + (q << 2);
+         work = (useBuffer && (fftObj->FFT_B != NULL) &&
+                 (fftObj->BufferSize >= workSize)) ?
+                fftObj->FFT_B : CFFT_AlignedAlloc(workSize);
+
+         //  [a, a + q)    (N - a - q, N - a]
+         Zb = work + fftObj->NN + (q << 3);
+         Zm = Zb + (q << 1);
+         CFFT_PrunedBands(FFT_S, FFT_TW, a, fftObj->N - a - q + 1, q, Zb, Zm,
+                          work, fftObj);
+
+         for(i = a; i <= b; i += k)
+         {
+             k = min(EXPLORE_CHUNK, b - i + 1);
+
+             //   (  CFFT_ExploreRange)
+             for(j = 0; j < k; ++j)
+             {
+                 T_i   = Zb + ((i + j - a) << 1);
+                 T_N_i = Zm + (((a + q - 1) - (i + j)) << 1);
+
+                 L[(j << 1) + 0] = mult * (T_i[0]   + T_N_i[0]);
+                 L[(j << 1) + 1] = mult * (T_i[1]   - T_N_i[1]);
+                 R[(j << 1) + 0] = mult * (T_i[1]   + T_N_i[1]);
+                 R[(j << 1) + 1] = mult * (T_N_i[0] - T_i[0]);
+             }
+
+             CFFT_ExploreBinsChunk(L, R, i, k, MagL, MagR, ACH, ArgL, ArgR,
+                                   PhaseLR, fftObj);
+         }
+
+         if(work != fftObj->FFT_B)
+         {
+             CFFT_AlignedFree(work);
+         }
+     }
+ }
+
+ /// <summary>
+ ///   :   
+ ///   (      ,
+ ///  N / 2 -   )
+ /// </summary>
+ /// <param name="data">   . </param>
+ /// <param name="N">  FFT. </param>
+ void CFFT_MirrorHalves(double *data, int N)
+ {
+     int i, N_2 = N >> 1;
+     double t;
+
+     for(i = 0; i < (N_2 >> 1); ++i)
+     {
+         t = data[i];
+         data[i] = data[N_2 - 1 - i];
+         data[N_2 - 1 - i] = t;
+
+         t = data[N_2 + i];
+         data[N_2 + i] = data[N - 1 - i];
+         data[N - 1 - i] = t;
+     }
+ }
+
+ /// <summary>
+ ///    FFT ( CFFT  MathCAD)
+ /// </summary>
+ /// <param name="FFT_T">   . </param>
+ /// <param name="Mag"> . </param>
+ /// <param name="Arg"> . </param>
+ /// <param name="usePolyphase">   FFT? </param
+ /// <param name="isMirror">   ? </param>
+ /// <param name="fftObj">  FFT,    . </param>
+ void CFFT_ComplexExplore(double *FFT_T, double *Mag, double *Arg,
+                          bool usePolyphase, bool isMirror,
+                          CFFT_Object *fftObj)
+ {
+     int N;
+
+     //   FFT
+     N = usePolyphase ? fftObj->NPoly : fftObj->N;
+
+     //         
+     // ,   -    
+     if(Mag != NULL)
+     {
+         fftObj->Magnitude(FFT_T, N, Mag);
+
+         if(isMirror)
+         {
+             CFFT_MirrorHalves(Mag, N);
+         }
+     }
+
+     if(Arg != NULL)
+     {
+         fftObj->Argument(FFT_T, N, Arg);
+
+         if(isMirror)
+         {
+             CFFT_MirrorHalves(Arg, N);
+         }
+     }
+ }
+
+ /// <summary>
+ ///    FFT (CFFT_RealProcess): 
+ ///      ""  CFFT_Explore
+ /// </summary>
+ /// <param name="FFT_T">    FFT. </param>
+ /// <param name="MagL"> . </param>
+ /// <param name="ArgL"> . </param>
+ /// <param name="fftObj">  FFT,    . </param>
+ void CFFT_RealExplore(double *FFT_T, double *MagL, double *ArgL,
+                       CFFT_Object *fftObj)
+ {
+     // ""    
+     if(MagL != NULL)
+     {
+         MagL[0] = FFT_T[0];
+         fftObj->Magnitude(FFT_T + 2, (fftObj->N >> 1) - 1, MagL + 1);
+     }
+
+     if(ArgL != NULL)
+     {
+         ArgL[0] = M_PI;
+         fftObj->Argument(FFT_T + 2, (fftObj->N >> 1) - 1, ArgL + 1);
+     }
+ }
+
+ /// <summary>
+ ///    double   dB
+ /// </summary>
+ /// <param name="data">   . </param>
+ /// <param name="zero_db_level">  "" . </param>
+ /// <param name="fftObj">  FFT,    . </param>
+ void dB_Scale(double *data, double zero_db_level,
+               CFFT_Object *fftObj)
+ {
+     int i;
+     for(i = 0; i < fftObj->N >> 1; ++i)
+     {
+         data[i] = 10 * log10(data[i] / zero_db_level); // log
+     }
+ }
+
+ /// <summary>
+ ///      -
+ ///    
+ /// </summary>
+ /// <param name="FFT_S">    (""  "" 
+ /// - ./.);    ,   
+ ///     . </param>
+ /// <param name="ACH_Difference">    
+ ///      . </param>
+ /// <param name="fftObj">  FFT,    . </param>
+ /// <returns>  "   
+ /// -   ". </returns>
+ CFFT_SelfTestResult SelfTest_S(double *FFT_S, double ACH_Difference,
+                                CFFT_Object *fftObj)
+ {
+     double *work, *FFT_S_backward, *FFT_T, *MagL, *MagR, *ACH, *ArgL, *ArgR,
+            *PhaseLR, *slideS, *bins;
+     int N2, FFT_S_Offset, i, f, r, pass, workSize, slideHop, slideSize,
+         ranges[4], permutation;
+     bool useTaperWindow, recoverAfterTaperWindow, useNorm, direction,
+          usePolyphase;
+     double maxDiff, FFT_T_i_Re, FFT_T_i_Im, FFT_T_N_i_Re, FFT_T_N_i_Im,
+            lx, ly, rx, ry, lx_, ly_, rx_, ry_, currentDiff, maxRef;
+     LARGE_INTEGER startCounter, CFFT_Process_counter, CFFT_Explore_counter, timerFrequency;
+     int N_iters = 10000, N_slides = 300, argMode;
+
+     // C "   
+     // -   "
+     CFFT_SelfTestResult selfTestResult;
+
+     // (  FFT / 2) -     
+     N2 = fftObj->N >> 1;
+
+     //         (
+     //  ,       
+     //   )
+     workSize = (fftObj->NN << 1) + (N2 * 6);
+     work = ((fftObj->FFT_B != NULL) && (fftObj->BufferSize >= workSize) &&
+             !CFFT_BufferOverlaps(fftObj, FFT_S, fftObj->NN)) ?
+            fftObj->FFT_B : CFFT_AlignedAlloc(workSize);
+
+     //    -      FFT
+     FFT_S_backward = work;
+
+     //  
+     FFT_T = FFT_S_backward + fftObj->NN;
+
+     //   -
+     MagL    = FFT_T + fftObj->NN;
+     MagR    = MagL  + N2;
+     ACH     = MagR  + N2;
+     ArgL    = ACH   + N2;
+     ArgR    = ArgL  + N2;
+     PhaseLR = ArgR  + N2;
+
+     //    ,  
+     //   -  
+     useTaperWindow = FALSE;
+     FFT_S_Offset   = 0;
+     recoverAfterTaperWindow = FALSE;
+     useNorm      = TRUE;
+     direction    = TRUE;
+     usePolyphase = FALSE;
+     CFFT_Process(FFT_S, FFT_S_Offset, FFT_T, useTaperWindow,
+                  recoverAfterTaperWindow, useNorm, direction,
+                  usePolyphase, fftObj);
+
+     //     
+     //   
+     CFFT_Explore(FFT_T, MagL, MagR, ACH, ArgL, ArgR, PhaseLR,
+                  usePolyphase, fftObj);
+
+     //       -  
+     //   
+     maxDiff = 0;
+     for(i = 1; i < N2; ++i)
+     {
+         FFT_T_i_Re   = FFT_T[(i << 1) + 0];
+         FFT_T_i_Im   = FFT_T[(i << 1) + 1];
+         FFT_T_N_i_Re = FFT_T[((fftObj->N - i) << 1) + 0];
+         FFT_T_N_i_Im = FFT_T[((fftObj->N - i) << 1) + 1];
+
+         lx = FFT_T_i_Re   + FFT_T_N_i_Re;
+         ly = FFT_T_i_Im   - FFT_T_N_i_Im;
+         rx = FFT_T_i_Im   + FFT_T_N_i_Im;
+         ry = FFT_T_N_i_Re - FFT_T_i_Re;
+
+         lx_ = 2 * MagL[i] * cos(ArgL[i]);
+         ly_ = 2 * MagL[i] * sin(ArgL[i]);
+         rx_ = 2 * MagR[i] * cos(ArgR[i]);
+         ry_ = 2 * MagR[i] * sin(ArgR[i]);
+
+         currentDiff = fabs(lx - lx_);
+         maxDiff     = (maxDiff < currentDiff) ? currentDiff : maxDiff;
+
+         currentDiff = fabs(ly - ly_);
+         maxDiff     = (maxDiff < currentDiff) ? currentDiff : maxDiff;
+
+         currentDiff = fabs(rx - rx_);
+         maxDiff     = (maxDiff < currentDiff) ? currentDiff : maxDiff;
+
+         currentDiff = fabs(ry - ry_);
+         maxDiff     = (maxDiff < currentDiff) ? currentDiff : maxDiff;
+     }
+
+     //       
+     //    
+     selfTestResult.MaxDiff_ALG_to_EXP_to_ALG = maxDiff;
+
+     //    ,  
+     //   -  
+     useTaperWindow = FALSE;
+     FFT_S_Offset   = 0;
+     recoverAfterTaperWindow = FALSE;
+     useNorm      = TRUE;
+     direction    = FALSE;
+     usePolyphase = FALSE;
+     CFFT_Process(FFT_T, FFT_S_Offset, FFT_S_backward, useTaperWindow,
+                  recoverAfterTaperWindow, useNorm, direction,
+                  usePolyphase, fftObj);
+
+     maxDiff = 0;
+     for(i = 0; i < fftObj->N; ++i)
+     {
+         currentDiff = fabs(FFT_S_backward[i] - FFT_S[i]);
+         maxDiff     = (maxDiff < currentDiff) ? currentDiff : maxDiff;
+     }
+
+     //     - 
+     // (  )
+     selfTestResult.MaxDiff_FORWARD_BACKWARD = maxDiff;
+
+     //   , 
+     //   -  
+     useTaperWindow = TRUE;
+     FFT_S_Offset   = 0;
+     recoverAfterTaperWindow = FALSE;
+     useNorm      = TRUE;
+     direction    = TRUE;
+     usePolyphase = FALSE;
+     CFFT_Process(FFT_S, FFT_S_Offset, FFT_T, useTaperWindow,
+                  recoverAfterTaperWindow, useNorm, direction,
+                  usePolyphase, fftObj);
+
+     //    , 
+     //   -  
+     useTaperWindow = TRUE;
+     FFT_S_Offset   = 0;
+     recoverAfterTaperWindow = TRUE;
+     useNorm      = TRUE;
+     direction    = FALSE;
+     usePolyphase = FALSE;
+     CFFT_Process(FFT_T, FFT_S_Offset, FFT_S_backward, useTaperWindow,
+                  recoverAfterTaperWindow, useNorm, direction,
+                  usePolyphase, fftObj);
+
+     maxDiff = 0;
+     for(i = (fftObj->NN / 2); i <= ((fftObj->NN * 3) / 4); ++i)
+     {
+         currentDiff = fabs(FFT_S_backward[i] - FFT_S[i]);
+         maxDiff     = (maxDiff < currentDiff) ? currentDiff : maxDiff;
+     }
+
+     //     -
+     //  (c   )
+     selfTestResult.MaxDiff_FORWARD_BACKWARD_AntiTW = maxDiff;
+
+     maxDiff = 0;
+     for(i = 0; i < N2; ++i)
+     {
+         currentDiff = fabs(ACH[i] - ACH_Difference);
+         maxDiff     = (maxDiff < currentDiff) ? currentDiff : maxDiff;
+     }
+
+     //       
+     selfTestResult.MaxDiff_ACH = maxDiff;
+
+     maxDiff = 0;
+     for(i = 0; i < N2; ++i)
+     {
+         currentDiff = fabs(PhaseLR[i]);
+         maxDiff     = (maxDiff < currentDiff) ? currentDiff : maxDiff;
+     }
+
+     //         
+     selfTestResult.MaxDiff_PhaseLR = maxDiff;
+
+     //   (NPoly ) -   N   
+     //  -  :   
+     useTaperWindow = TRUE;
+     FFT_S_Offset   = 0;
+     recoverAfterTaperWindow = FALSE;
+     useNorm      = TRUE;
+     direction    = TRUE;
+     usePolyphase = TRUE;
+     CFFT_Process(FFT_S, FFT_S_Offset, FFT_T, useTaperWindow,
+                  recoverAfterTaperWindow, useNorm, direction,
+                  usePolyphase, fftObj);
+
+     recoverAfterTaperWindow = TRUE;
+     direction = FALSE;
+     CFFT_Process(FFT_T, FFT_S_Offset, FFT_S_backward, useTaperWindow,
+                  recoverAfterTaperWindow, useNorm, direction,
+                  usePolyphase, fftObj);
+
+     //   -     ( 
+     //  , NNPoly <= 3 * N2)
+     recoverAfterTaperWindow = FALSE;
+     direction = TRUE;
+     CFFT_Process(FFT_S_backward, FFT_S_Offset, MagL, useTaperWindow,
+                  recoverAfterTaperWindow, useNorm, direction,
+                  usePolyphase, fftObj);
+
+     maxDiff = 0;
+     for(i = 0; i < fftObj->NNPoly; ++i)
+     {
+         currentDiff = fabs(MagL[i] - FFT_T[i]);
+         maxDiff     = (maxDiff < currentDiff) ? currentDiff : maxDiff;
+     }
+
+     //      - 
+     selfTestResult.MaxDiff_FORWARD_BACKWARD_Poly = maxDiff;
+
+     //  FFT ""  FFT_S -   
+     // FFT      "" 
+     for(i = 0; i < fftObj->N; ++i)
+     {
+         FFT_S_backward[(i << 1) + 0] = FFT_S[i << 1];
+         FFT_S_backward[(i << 1) + 1] = 0;
+     }
+
+     useTaperWindow = TRUE;
+     FFT_S_Offset   = 0;
+     recoverAfterTaperWindow = FALSE;
+     useNorm      = TRUE;
+     direction    = TRUE;
+     usePolyphase = FALSE;
+     CFFT_Process(FFT_S_backward, FFT_S_Offset, FFT_T, useTaperWindow,
+                  recoverAfterTaperWindow, useNorm, direction,
+                  usePolyphase, fftObj);
+
+     CFFT_Explore(FFT_T, MagL, MagR, ACH, ArgL, ArgR, PhaseLR,
+                  usePolyphase, fftObj);
+
+     for(i = 0; i < fftObj->N; ++i)
+     {
+         FFT_S_backward[i] = FFT_S[i << 1];
+     }
+
+     CFFT_RealProcess(FFT_S_backward, FFT_S_Offset, FFT_T, useTaperWindow,
+                      recoverAfterTaperWindow, useNorm, direction, fftObj);
+     CFFT_RealExplore(FFT_T, MagR, ArgR, fftObj);
+
+     // ""     ( ),  -
+     //   
+     maxDiff = fabs(MagL[0] - MagR[0]);
+     for(i = 1; i < N2; ++i)
+     {
+         currentDiff = fabs(MagL[i] * cos(ArgL[i]) - MagR[i] * cos(ArgR[i]));
+         maxDiff     = (maxDiff < currentDiff) ? currentDiff : maxDiff;
+
+         currentDiff = fabs(MagL[i] * sin(ArgL[i]) - MagR[i] * sin(ArgR[i]));
+         maxDiff     = (maxDiff < currentDiff) ? currentDiff : maxDiff;
+     }
+
+     //     FFT 
+     // 
+     selfTestResult.MaxDiff_REAL_to_COMPLEX = maxDiff;
+
+     //  FFT    - -
+     // (  -    FFT_S_backward)
+     useTaperWindow = FALSE;
+     CFFT_RealProcess(FFT_S_backward, FFT_S_Offset, FFT_T, useTaperWindow,
+                      recoverAfterTaperWindow, useNorm, direction, fftObj);
+
+     direction = FALSE;
+     CFFT_RealProcess(FFT_T, FFT_S_Offset, FFT_S_backward + fftObj->N,
+                      useTaperWindow, recoverAfterTaperWindow, useNorm,
+                      direction, fftObj);
+
+     maxDiff = 0;
+     for(i = 0; i < fftObj->N; ++i)
+     {
+         currentDiff = fabs(FFT_S_backward[fftObj->N + i] - FFT_S[i << 1]);
+         maxDiff     = (maxDiff < currentDiff) ? currentDiff : maxDiff;
+     }
+
+     //    -  FFT
+     selfTestResult.MaxDiff_REAL_FORWARD_BACKWARD = maxDiff;
+
+     //  DFT: N_slides      ( 
+     //   )    FFT  .  -
+     //   FFT_S
+     slideHop  = max(CFFT_SlideMaxHop(fftObj), 1);
+     slideSize = fftObj->NN + ((N_slides * slideHop) << 1);
+     slideS    = CFFT_AlignedAlloc(slideSize);
+
+     for(i = 0; i < slideSize; ++i)
+     {
+         slideS[i] = FFT_S[i % fftObj->NN];
+     }
+
+     recoverAfterTaperWindow = FALSE;
+     useNorm      = TRUE;
+     direction    = TRUE;
+     usePolyphase = FALSE;
+
+     maxDiff = maxRef = 0;
+     for(pass = 0; pass < 2; ++pass)
+     {
+         useTaperWindow = (pass == 1);
+         FFT_S_Offset   = 0;
+         CFFT_SlideReset(fftObj);
+
+         for(f = 0; f < N_slides; ++f)
+         {
+             CFFT_ProcessSliding(slideS, FFT_S_Offset, FFT_T, useTaperWindow,
+                                 useNorm, fftObj);
+             CFFT_Process(slideS, FFT_S_Offset, MagL, useTaperWindow,
+                          recoverAfterTaperWindow, useNorm, direction,
+                          usePolyphase, fftObj);
+
+             for(i = 0; i < fftObj->NN; ++i)
+             {
+                 currentDiff = fabs(FFT_T[i] - MagL[i]);
+                 maxDiff     = (maxDiff < currentDiff) ? currentDiff : maxDiff;
+                 maxRef      = max(maxRef, fabs(MagL[i]));
+             }
+
+             FFT_S_Offset += (1 + (f % slideHop)) << 1;
+         }
+     }
+
+     //    -   
+     CFFT_SlideReset(fftObj);
+     CFFT_AlignedFree(slideS);
+
+     //     DFT  
+     //  (    )
+     selfTestResult.MaxDiff_SLIDING = (maxRef > 0) ? (maxDiff / maxRef) : maxDiff;
+
+     //  :   ( ) 
+     //  ( FFT)   CFFT_Explore  
+     //    .  CFFT_ExploreBins -  
+     //   (FFT_S_backward  FFT_T   ):  
+     //           
+     ranges[0] = N2 >> 3;
+     ranges[1] = min(ranges[0] + (PRUNED_FFT_MIN_BINS >> 1), N2 - 1);
+     ranges[2] = N2 >> 1;
+     ranges[3] = min(ranges[2] + (PRUNED_FFT_MIN_BINS << 3), N2 - 1);
+
+     useTaperWindow = TRUE;
+     FFT_S_Offset   = 0;
+     recoverAfterTaperWindow = FALSE;
+     useNorm      = TRUE;
+     direction    = TRUE;
+     usePolyphase = FALSE;
+
+     CFFT_Process(FFT_S, FFT_S_Offset, FFT_T, useTaperWindow,
+                  recoverAfterTaperWindow, useNorm, direction,
+                  usePolyphase, fftObj);
+     CFFT_Explore(FFT_T, MagL, MagR, ACH, ArgL, ArgR, PhaseLR,
+                  usePolyphase, fftObj);
+
+     bins        = work;
+     permutation = fftObj->Permutation;
+
+     maxDiff = 0;
+     for(pass = 0; pass < 2; ++pass)
+     {
+         if(pass == 1)
+         {
+             CFFT_SetPermutation(fftObj, (permutation == PERMUTE_INPLACE) ?
+                                 PERMUTE_TABLE : PERMUTE_INPLACE);
+         }
+
+         CFFT_ExploreBins(FFT_S, FFT_S_Offset, ranges, 2, bins, bins + N2,
+                          bins + (N2 * 2), bins + (N2 * 3), bins + (N2 * 4),
+                          bins + (N2 * 5), useTaperWindow, useNorm, fftObj);
+
+         // ,     - ,  - 
+         //   (   +/-PI)
+         for(r = 0; r < 4; r += 2)
+         {
+             for(i = ranges[r]; i <= ranges[r + 1]; ++i)
+             {
+                 currentDiff = max(fabs(bins[i]            - MagL[i]),
+                                   fabs(bins[N2 + i]       - MagR[i]));
+                 currentDiff = max(currentDiff,
+                                   fabs(bins[(N2 * 2) + i] - ACH[i]));
+                 currentDiff = max(currentDiff,
+                                   fabs(bins[(N2 * 5) + i] - PhaseLR[i]));
+                 currentDiff = max(currentDiff,
+                                   fabs(bins[i] * cos(bins[(N2 * 3) + i]) -
+                                        MagL[i] * cos(ArgL[i])));
+                 currentDiff = max(currentDiff,
+                                   fabs(bins[i] * sin(bins[(N2 * 3) + i]) -
+                                        MagL[i] * sin(ArgL[i])));
+                 currentDiff = max(currentDiff,
+                                   fabs(bins[N2 + i] * cos(bins[(N2 * 4) + i]) -
+                                        MagR[i] * cos(ArgR[i])));
+                 currentDiff = max(currentDiff,
+                                   fabs(bins[N2 + i] * sin(bins[(N2 * 4) + i]) -
+                                        MagR[i] * sin(ArgR[i])));
+                 maxDiff     = (maxDiff < currentDiff) ? currentDiff : maxDiff;
+             }
+         }
+     }
+
+     CFFT_SetPermutation(fftObj, permutation);
+
+     //     
+     selfTestResult.MaxDiff_BINS = maxDiff;
+
+     // Performance Test
+     QueryPerformanceFrequency(&timerFrequency);
+     CFFT_Process_counter.QuadPart = CFFT_Explore_counter.QuadPart = 0;
+               
+     //    ,  
      //   -  
      useTaperWindow = FALSE;
      FFT_S_Offset   = 0;
      recoverAfterTaperWindow = FALSE;
-     useNorm      = TRUE;
+     useNorm      = FALSE;
      direction    = TRUE;
      usePolyphase = FALSE;
-     CFFT_Process(FFT_S, FFT_S_Offset, FFT_T, useTaperWindow,
-                  recoverAfterTaperWindow, useNorm, direction,
-                  usePolyphase, fftObj);
 
-     //     
-     //   
-     CFFT_Explore(FFT_T, MagL, MagR, ACH, ArgL, ArgR, PhaseLR,
-                  usePolyphase, fftObj);
+     // CFFT_Process_time
+     startCounter.QuadPart = 0;
+     QueryPerformanceCounter(&startCounter);
+     for (i = 0; i < N_iters; ++i)
+     {
+        CFFT_Process(FFT_S, FFT_S_Offset, FFT_T, useTaperWindow,
+                     recoverAfterTaperWindow, useNorm, direction,
+                     usePolyphase, fftObj);
+     }
+     QueryPerformanceCounter(&CFFT_Process_counter);
+     CFFT_Process_counter.QuadPart -= startCounter.QuadPart;
+     selfTestResult.CFFT_Process_time  = (long double)CFFT_Process_counter.QuadPart / (long double)timerFrequency.QuadPart;
+     selfTestResult.CFFT_Process_time /= (double)N_iters;
+
+     // CFFT_Explore_time
+     startCounter.QuadPart = 0;
+     QueryPerformanceCounter(&startCounter);
+     for (i = 0; i < N_iters; ++i)
+     {
+        CFFT_Explore(FFT_T, MagL, MagR, ACH, ArgL, ArgR, PhaseLR,
+                     usePolyphase, fftObj);
+     }
+     QueryPerformanceCounter(&CFFT_Explore_counter);
+     CFFT_Explore_counter.QuadPart -= startCounter.QuadPart;
+     selfTestResult.CFFT_Explore_time  = (long double)CFFT_Explore_counter.QuadPart / (long double)timerFrequency.QuadPart;
+     selfTestResult.CFFT_Explore_time /= (double)N_iters;
+
+     // CFFT_ExploreFast_time ( )
+     argMode = fftObj->ArgMode;
+     CFFT_SetArgMode(fftObj, ARG_FAST);
+
+     startCounter.QuadPart = 0;
+     QueryPerformanceCounter(&startCounter);
+     for (i = 0; i < N_iters; ++i)
+     {
+        CFFT_Explore(FFT_T, MagL, MagR, ACH, ArgL, ArgR, PhaseLR,
+                     usePolyphase, fftObj);
+     }
+     QueryPerformanceCounter(&CFFT_Explore_counter);
+     CFFT_Explore_counter.QuadPart -= startCounter.QuadPart;
+     selfTestResult.CFFT_ExploreFast_time  = (long double)CFFT_Explore_counter.QuadPart / (long double)timerFrequency.QuadPart;
+     selfTestResult.CFFT_ExploreFast_time /= (double)N_iters;
+
+     CFFT_SetArgMode(fftObj, argMode);
+
+     // CFFT_Init_time
+     selfTestResult.CFFT_Init_time = CFFT_InitTime(fftObj, N_iters / 100);
+          
+     //     (  
+     //   )
+     if(!CFFT_BufferOverlaps(fftObj, FFT_S, fftObj->NN))
+     {
+         SAFE_DELETE(FFT_S);
+     }
+
+     if(work != fftObj->FFT_B)
+     {
+         CFFT_AlignedFree(work);
+     }
+
+     //     
+     if(selfTestResult.MaxDiff_ACH                     <= MAX_FFT_DIFF &&
+        selfTestResult.MaxDiff_ALG_to_EXP_to_ALG       <= MAX_FFT_DIFF &&
+        selfTestResult.MaxDiff_FORWARD_BACKWARD        <= MAX_FFT_DIFF &&
+        selfTestResult.MaxDiff_FORWARD_BACKWARD_AntiTW <= MAX_FFT_DIFF &&
+        selfTestResult.MaxDiff_FORWARD_BACKWARD_Poly   <= MAX_FFT_DIFF &&
+        selfTestResult.MaxDiff_REAL_to_COMPLEX         <= MAX_FFT_DIFF &&
+        selfTestResult.MaxDiff_REAL_FORWARD_BACKWARD   <= MAX_FFT_DIFF &&
+        selfTestResult.MaxDiff_SLIDING                 <= MAX_FFT_DIFF &&
+        selfTestResult.MaxDiff_BINS                    <= MAX_FFT_DIFF &&
+        selfTestResult.MaxDiff_PhaseLR                 <= MAX_FFT_DIFF)
+     {
+         selfTestResult.AllOK = TRUE;
+
+     } else
+     {
+         selfTestResult.AllOK = FALSE;
+     }
+
+#ifdef DUMP_MODE
+
+     //     
+     DumpInt(&selfTestResult.AllOK,
+             1, DUMP_NAME, "AllOK.int32");
+
+     //      
+     DumpDouble(&selfTestResult.MaxDiff_ACH,
+                1, DUMP_NAME, "MaxDiff_ACH.double");
+
+     // Max.  ALG -> EXP  
+     DumpDouble(&selfTestResult.MaxDiff_ALG_to_EXP_to_ALG,
+                1, DUMP_NAME, "MaxDiff_ALG_to_EXP_to_ALG.double");
+
+     // Max.  FORVARD + BACKWARD
+     DumpDouble(&selfTestResult.MaxDiff_FORWARD_BACKWARD,
+                1, DUMP_NAME, "MaxDiff_FORWARD_BACKWARD.double");
+
+     //...  + .  TW
+     DumpDouble(&selfTestResult.MaxDiff_FORWARD_BACKWARD_AntiTW,
+                1, DUMP_NAME, "MaxDiff_FORWARD_BACKWARD_AntiTW.double");
+
+     //...    FFT
+     DumpDouble(&selfTestResult.MaxDiff_FORWARD_BACKWARD_Poly,
+                1, DUMP_NAME, "MaxDiff_FORWARD_BACKWARD_Poly.double");
+
+     // Max.   FFT  
+     DumpDouble(&selfTestResult.MaxDiff_REAL_to_COMPLEX,
+                1, DUMP_NAME, "MaxDiff_REAL_to_COMPLEX.double");
+
+     //...  FORVARD + BACKWARD  FFT
+     DumpDouble(&selfTestResult.MaxDiff_REAL_FORWARD_BACKWARD,
+                1, DUMP_NAME, "MaxDiff_REAL_FORWARD_BACKWARD.double");
+
+     // Max.    DFT   FFT
+     DumpDouble(&selfTestResult.MaxDiff_SLIDING,
+                1, DUMP_NAME, "MaxDiff_SLIDING.double");
+
+     // Max.   
+     DumpDouble(&selfTestResult.MaxDiff_BINS,
+                1, DUMP_NAME, "MaxDiff_BINS.double");
+
+     // .      
+     DumpDouble(&selfTestResult.MaxDiff_PhaseLR,
+                1, DUMP_NAME, "MaxDiff_PhaseLR.double");
+
+     //   CFFT_Process()
+     DumpDouble(&selfTestResult.CFFT_Process_time,
+                1, DUMP_NAME, "CFFT_Process_time.double");
+     
+     //   CFFT_Explore()
+     DumpDouble(&selfTestResult.CFFT_Explore_time,
+                1, DUMP_NAME, "CFFT_Explore_time.double");
+
+     //   CFFT_Explore()   ARG_FAST
+     DumpDouble(&selfTestResult.CFFT_ExploreFast_time,
+                1, DUMP_NAME, "CFFT_ExploreFast_time.double");
+
+     //     FFT
+     DumpDouble(&selfTestResult.CFFT_Init_time,
+                1, DUMP_NAME, "CFFT_Init_time.double");
+
+#endif
+
+     //   
+     return selfTestResult;
+ }
+
+ /// <summary>
+ ///      -
+ ///     (" ")
+ /// </summary>
+ /// <param name="ACH_Difference">    
+ ///      . </param>
+ /// <param name="fftObj">  FFT,    . </param>
+ /// <returns>  "   
+ /// -   ". </returns>
+ CFFT_SelfTestResult SelfTest_RND(double ACH_Difference,
+                                  CFFT_Object *fftObj)
+ {    
+     double randMult, randomValue;
+     int i;
+     
+     //    - 
+     double *FFT_S = (double *)calloc(fftObj->NN, sizeof(double));
+
+     //    
+     srand(time(NULL));
+
+     //   
+     randMult = 1E07;
+
+     //     ...
+     for(i = 0; i < fftObj->N; ++i)
+     {
+         //      
+         //(   )...
+         randomValue = (((double)rand() / (double)RAND_MAX) * randMult) -
+                       (((double)rand() / (double)RAND_MAX) * randMult);
+
+         // ""   ""   
+         //  "ACH_Difference" 
+         FFT_S[(i << 1) + 0] = randomValue / ACH_Difference;
+         FFT_S[(i << 1) + 1] = randomValue;
+     }
+
+     //   ...
+     return SelfTest_S(FFT_S, ACH_Difference, fftObj);
+ }
+
+ /// <summary>
+ ///      
+ /// </summary>
+ /// <param name="data">     . </param>
+ /// <param name="startIdx">  . </param>
+ /// <param name="finishIdx">  . </param>
+ int GetMaxIdx(double *data, int startIdx, int finishIdx)
+ {
+     int i, maxValIdxL, maxValIdxR;
+     double currVal, maxVal;
+
+     //    ...
+     maxValIdxL = maxValIdxR = startIdx;
+     maxVal = data[maxValIdxL];
+
+     for(i = startIdx + 1; i <= finishIdx; ++i)
+     {
+         currVal = data[i];
+
+         //     -
+         //    ...
+         if(currVal > maxVal)
+         {
+             maxValIdxL = maxValIdxR = i;
+             maxVal = currVal;
+
+         } else
+         //...   
+         //    
+         if(currVal == maxVal)
+         {
+             maxValIdxR = i;
+         }
+     }
+
+     return (maxValIdxL + maxValIdxR) >> 1;
+ }
+ 
+ /// <summary>
+ ///       
+ /// </summary>
+ /// <param name="Mag">  . </param>
+ /// <param name="L">      . </param>
+ /// <param name="R">      . </param>
+ /// <param name="sampFreq">  . </param>
+ /// <param name="isComplex">  ? </param>
+ /// <param name="fftObj">  FFT,    . </param>
+ /// <returns>  ,    . </returns>
+ double CalcExactFreq(double *Mag, int L, int R,
+                      double sampFreq, bool isComplex,
+                      CFFT_Object *fftObj)
+ {
+     int i;
+     double harmSum, exactFreqIdx;
+          
+     //   
+     harmSum = 0;
+     for(i = L; i <= R; ++i)
+     {
+         harmSum += Mag[i];
+     }
+
+     //    
+     exactFreqIdx = 0;
+     for(i = L; i <= R; ++i)
+     {
+         exactFreqIdx += (Mag[i] / harmSum) * (double)i;
+     }
+
+     //   
+     return FreqNode(exactFreqIdx, sampFreq, isComplex, fftObj);
+ }
+
+ /// <summary>
+ ///       
+ /// </summary>
+ /// <param name="Mag">  . </param>
+ /// <param name="L">      . </param>
+ /// <param name="R">      . </param>
+ /// <param name="depth">  . </param>
+ /// <param name="sampFreq">  . </param>
+ /// <param name="isComplex">  ? </param>
+ /// <param name="fftObj">  FFT,    . </param>
+ /// <returns>  ,    . </returns>
+ double ExactFreq(double *Mag, int L, int R, int depth,
+                  double sampFreq, bool isComplex,
+                  CFFT_Object *fftObj)
+ {
+     int fft_N, FFT_NodeMax, startIdx, finishIdx, startIdx2, finishIdx2,
+         deltaStart, deltaFinish, deltaCorr;
+
+     //      
+     FFT_NodeMax = GetMaxIdx(Mag, L, R);
+   
+     //   
+     startIdx  = L;
+     finishIdx = R;
+
+     //   FFT
+     fft_N = fftObj->N;
+
+     //  
+     startIdx2  = startIdx  >= 0 ? startIdx : 0;
+     finishIdx2 = finishIdx <= (fft_N - 1) ? finishIdx : (fft_N - 1);
+
+     //       
+     deltaStart  = abs(startIdx2  - startIdx);
+     deltaFinish = abs(finishIdx2 - finishIdx);
+     deltaCorr   = max(deltaStart, deltaFinish);
+     depth      -= deltaCorr;
+
+     //   
+     startIdx  = FFT_NodeMax - depth;
+     finishIdx = FFT_NodeMax + depth;
+
+     //   
+     return CalcExactFreq(Mag, startIdx, finishIdx, sampFreq, isComplex, fftObj);
+ }
+
+ /// <summary>
+ ///       
+ /// </summary>
+ /// <param name="Mag">  . </param>
+ /// <param name="depth">  . </param>
+ /// <param name="sampFreq">  . </param>
+ /// <param name="isComplex">  ? </param>
+ /// <param name="fftObj">  FFT,    . </param>
+ /// <returns>  ,    . </returns>
+ double ExactFreqAuto(double *Mag, int depth,
+                      double sampFreq, bool isComplex,
+                      CFFT_Object *fftObj)
+ {
+     return ExactFreq(Mag, 1, (fftObj->N >> 1) - 1, depth, sampFreq, isComplex, fftObj);
+ }
+
+ /// <summary>
+ ///     PI * halfTurns ( 
+ ///   [0, 2)  -     halfTurns)
+ /// </summary>
+ /// <param name="Z">   (re + im). </param>
+ /// <param name="halfTurns">   . </param>
+ void CZoom_Phasor(double *Z, double halfTurns)
+ {
+     halfTurns = M_PI * fmod(halfTurns, 2.0);
+
+     Z[0] = cos(halfTurns);
+     Z[1] = sin(halfTurns);
+ }
+
+ /// <summary>
+ /// ""  Zoom-FFT ( FFT   )
+ /// </summary>
+ /// <param name="zoomObj">  Zoom-FFT,   
+ /// . </param>
+ void CZoom_Destructor(CZoom_Object *zoomObj)
+ {
+     if(zoomObj->Conv != NULL)
+     {
+         CFFT_Destructor(zoomObj->Conv);
+     }
+
+     SAFE_DELETE(zoomObj->ChirpIn);
+     SAFE_DELETE(zoomObj->ChirpOut);
+     SAFE_DELETE(zoomObj->Kernel);
+     SAFE_DELETE(zoomObj->WorkL);
+     SAFE_DELETE(zoomObj->WorkR);
+     SAFE_DELETE(zoomObj);
+ }
+
+ /// <summary>
+ ///   Zoom-FFT:    FFT  M 
+ ///    f1  f2  (   
+ ///    N).     k = k1 + i * dk N- FFT
+ ///  chirp-z  (): k * n = (k^2 + n^2 -
+ /// (k - n)^2) / 2       exp(j * PI * dk * m^2 / N),
+ ///   FFT  L >= N + M - 1 (  
+ /// )
+ /// </summary>
+ /// <param name="fftObj">  FFT  (   
+ ///   Zoom-FFT). </param>
+ /// <param name="f1">    . </param>
+ /// <param name="f2">    . </param>
+ /// <param name="M"> -  . </param>
+ /// <param name="sampFreq">  . </param>
+ /// <param name="isComplex">  ? </param>
+ /// <returns>  Zoom-FFT (NULL -  ). </returns>
+ CZoom_Object * CZoom_Init(CFFT_Object *fftObj, double f1, double f2, int M,
+                           double sampFreq, bool isComplex)
+ {
+     CZoom_Object *zoomObj;
+     int i, N, L;
+     double k1, dk;
+
+     if((fftObj == NULL) || (M < 1) || (f2 < f1) || (sampFreq <= 0))
+     {
+         return NULL;
+     }
+
+     zoomObj = (CZoom_Object *)calloc(1, sizeof(CZoom_Object));
+
+     N  = fftObj->N;
+     k1 = FFT_Node(f1, sampFreq, isComplex, fftObj);
+     dk = (M > 1) ? ((FFT_Node(f2, sampFreq, isComplex, fftObj) - k1) /
+                     (double)(M - 1)) : 0;
+
+     //   -    
+     L = ToLowerPowerOf2(N + M - 1);
+     L = (L < (N + M - 1)) ? (L << 1) : L;
+
+     zoomObj->FFT       = fftObj;
+     zoomObj->Conv      = CFFT_Init(L, RECTANGULAR_13dbPS, 0, 0,
+                                    DEFAULT_FFT_ENGINE);
+     zoomObj->M         = M;
+     zoomObj->NodeStart = k1;
+     zoomObj->NodeStep  = dk;
+     zoomObj->ChirpIn   = (double *)calloc(N << 1, sizeof(double));
+     zoomObj->ChirpOut  = (double *)calloc(M << 1, sizeof(double));
+     zoomObj->Kernel    = (double *)calloc(L << 1, sizeof(double));
+     zoomObj->WorkL     = (double *)calloc(L << 1, sizeof(double));
+     zoomObj->WorkR     = (double *)calloc(L << 1, sizeof(double));
+
+     // : exp(-j * PI * (2 * k1 * n + dk * n^2) / N)
+     for(i = 0; i < N; ++i)
+     {
+         CZoom_Phasor(zoomObj->ChirpIn + (i << 1),
+                      -((2.0 * k1 * i) + (dk * (double)i * (double)i)) / N);
+     }
+
+     // : exp(-j * PI * dk * k^2 / N)
+     for(i = 0; i < M; ++i)
+     {
+         CZoom_Phasor(zoomObj->ChirpOut + (i << 1),
+                      -(dk * (double)i * (double)i) / N);
+     }
+
+     //   exp(j * PI * dk * m^2 / N), m = -(N - 1) .. M - 1
+     // ( m -   ; L >= N + M - 1 -  )
+     for(i = 0; i < max(M, N); ++i)
+     {
+         if(i < M)
+         {
+             CZoom_Phasor(zoomObj->Kernel + (i << 1),
+                          (dk * (double)i * (double)i) / N);
+         }
+
+         if((i > 0) && (i < N))
+         {
+             CZoom_Phasor(zoomObj->Kernel + ((L - i) << 1),
+                          (dk * (double)i * (double)i) / N);
+         }
+     }
+
+     CFFT_Process(zoomObj->Kernel, 0, zoomObj->Kernel, FALSE, FALSE, FALSE,
+                  DIRECT, FALSE, zoomObj->Conv);
+     zoomObj->Conv->Scale(zoomObj->Kernel, L << 1, 1.0 / L);
+
+     return zoomObj;
+ }
+
+ /// <summary>
+ ///      chirp-z 
+ /// ( )
+ /// </summary>
+ /// <param name="work">   (N , 
+ ///   L ). </param>
+ /// <param name="zoomObj">  Zoom-FFT,   
+ /// . </param>
+ void CZoom_Convolve(double *work, CZoom_Object *zoomObj)
+ {
+     int i, nn;
+     double re, *K;
+
+     nn = zoomObj->Conv->NN;
+     K  = zoomObj->Kernel;
+
+     memset(work + zoomObj->FFT->NN, 0,
+            (nn - zoomObj->FFT->NN) * sizeof(double));
+
+     CFFT_Process(work, 0, work, FALSE, FALSE, FALSE, DIRECT, FALSE,
+                  zoomObj->Conv);
+
+     for(i = 0; i < nn; i += 2)
+     {
+         re          = (work[i] * K[i])     - (work[i + 1] * K[i + 1]);
+         work[i + 1] = (work[i] * K[i + 1]) + (work[i + 1] * K[i]);
+         work[i]     = re;
+     }
+
+     //  1/L    :    
+     //  
+     CFFT_Process(work, 0, work, FALSE, FALSE, TRUE, REVERSE, FALSE,
+                  zoomObj->Conv);
+ }
+
+ /// <summary>
+ ///   (  ):    
+ /// ""  ""   
+ /// </summary>
+ /// <param name="FFT_S">    (N ). </param>
+ /// <param name="FFT_TW">   (NULL -  ). </param>
+ /// <param name="workL">  (workR == NULL)  "" . </param>
+ /// <param name="workR"> ""  (NULL -   ). </param>
+ /// <param name="zoomObj">  Zoom-FFT,   
+ /// . </param>
+ void CZoom_Modulate(double *FFT_S, double *FFT_TW, double *workL,
+                     double *workR, CZoom_Object *zoomObj)
+ {
+     int i;
+     double l, r, *C;
+
+     C = zoomObj->ChirpIn;
+
+     for(i = 0; i < zoomObj->FFT->NN; i += 2)
+     {
+         l = FFT_S[i];
+         r = FFT_S[i + 1];
+
+         if(FFT_TW != NULL)
+         {
+             l *= FFT_TW[i >> 1];
+             r *= FFT_TW[i >> 1];
+         }
+
+         if(workR == NULL)
+         {
+             workL[i]     = (l * C[i])     - (r * C[i + 1]);
+             workL[i + 1] = (l * C[i + 1]) + (r * C[i]);
+
+         } else
+         {
+             workL[i]     = l * C[i];
+             workL[i + 1] = l * C[i + 1];
+             workR[i]     = r * C[i];
+             workR[i + 1] = r * C[i + 1];
+         }
+     }
+ }
+
+ /// <summary>
+ /// Zoom-FFT:    M   ( -  
+ ///  CFFT_Process   )
+ /// </summary>
+ /// <param name="FFT_S">   
+ /// (""  ""  - ./.). </param>
+ /// <param name="FFT_S_Offset">     
+ ///   FFT_S. </param>
+ /// <param name="FFT_T">    (M  re + im). </param>
+ /// <param name="useTaperWindow">   ? </param>
+ /// <param name="useNorm">   1/N? </param>
+ /// <param name="zoomObj">  Zoom-FFT,   
+ /// . </param>
+ void CZoom_Process(double *FFT_S, int FFT_S_Offset, double *FFT_T,
+                    bool useTaperWindow, bool useNorm, CZoom_Object *zoomObj)
+ {
+     int i;
+     double mult, *C, *Y;
+
+     CZoom_Modulate(FFT_S + FFT_S_Offset,
+                    useTaperWindow ? zoomObj->FFT->FFT_TW : NULL,
+                    zoomObj->WorkL, NULL, zoomObj);
+     CZoom_Convolve(zoomObj->WorkL, zoomObj);
+
+     mult = useNorm ? (1.0 / zoomObj->FFT->N) : 1.0;
+     C    = zoomObj->ChirpOut;
+     Y    = zoomObj->WorkL;
+
+     for(i = 0; i < (zoomObj->M << 1); i += 2)
+     {
+         FFT_T[i]     = mult * ((Y[i] * C[i])     - (Y[i + 1] * C[i + 1]));
+         FFT_T[i + 1] = mult * ((Y[i] * C[i + 1]) + (Y[i + 1] * C[i]));
+     }
+ }
+
+ /// <summary>
+ /// Zoom-FFT   ""  "" : M 
+ ///      ( -   CFFT_Explore 
+ /// CFFT_Process;  ,   , 
+ /// ).  ,   
+ /// chirp-z      
+ /// </summary>
+ /// <param name="FFT_S">   
+ /// (""  ""  - ./.). </param>
+ /// <param name="FFT_S_Offset">     
+ ///   FFT_S. </param>
+ /// <param name="MagL">  "" . </param>
+ /// <param name="MagR">  "" . </param>
+ /// <param name="ACH"> . </param>
+ /// <param name="ArgL">  "" . </param>
+ /// <param name="ArgR">  "" . </param>
+ /// <param name="PhaseLR">    . </param>
+ /// <param name="useTaperWindow">   ? </param>
+ /// <param name="useNorm">   1/N? </param>
+ /// <param name="zoomObj">  Zoom-FFT,   
+ /// . </param>
+ void CZoom_Explore(double *FFT_S, int FFT_S_Offset, double *MagL,
+                    double *MagR, double *ACH, double *ArgL, double *ArgR,
+                    double *PhaseLR, bool useTaperWindow, bool useNorm,
+                    CZoom_Object *zoomObj)
+ {
+     int i, j, k;
+     double mult, *C, *YL, *YR;
+     double L[EXPLORE_CHUNK << 1], R[EXPLORE_CHUNK << 1];
+
+     CZoom_Modulate(FFT_S + FFT_S_Offset,
+                    useTaperWindow ? zoomObj->FFT->FFT_TW : NULL,
+                    zoomObj->WorkL, zoomObj->WorkR, zoomObj);
+     CZoom_Convolve(zoomObj->WorkL, zoomObj);
+     CZoom_Convolve(zoomObj->WorkR, zoomObj);
+
+     //    -    
+     mult = 2.0 * (useNorm ? (1.0 / zoomObj->FFT->N) : 1.0);
+     C    = zoomObj->ChirpOut;
+     YL   = zoomObj->WorkL;
+     YR   = zoomObj->WorkR;
+
+     for(i = 0; i < zoomObj->M; i += k)
+     {
+         k = min(EXPLORE_CHUNK, zoomObj->M - i);
+
+         for(j = 0; j < (k << 1); j += 2)
+         {
+             L[j]     = mult * ((YL[(i << 1) + j] * C[(i << 1) + j]) -
+                                (YL[(i << 1) + j + 1] * C[(i << 1) + j + 1]));
+             L[j + 1] = mult * ((YL[(i << 1) + j] * C[(i << 1) + j + 1]) +
+                                (YL[(i << 1) + j + 1] * C[(i << 1) + j]));
+             R[j]     = mult * ((YR[(i << 1) + j] * C[(i << 1) + j]) -
+                                (YR[(i << 1) + j + 1] * C[(i << 1) + j + 1]));
+             R[j + 1] = mult * ((YR[(i << 1) + j] * C[(i << 1) + j + 1]) +
+                                (YR[(i << 1) + j + 1] * C[(i << 1) + j]));
+         }
+
+         CFFT_ExploreChannels(L, R, i, k, MagL, MagR, ACH, ArgL, ArgR,
+                              PhaseLR, zoomObj->FFT);
+     }
+ }
+
+ /// <summary>
+ ///      Zoom-FFT
+ /// </summary>
+ /// <param name="zoomNode">    ( ). </param>
+ /// <param name="sampFreq">  . </param>
+ /// <param name="isComplex">  ? </param>
+ /// <param name="zoomObj">  Zoom-FFT,   
+ /// . </param>
+ double ZoomFreqNode(double zoomNode, double sampFreq, bool isComplex,
+                     CZoom_Object *zoomObj)
+ {
+     return FreqNode(zoomObj->NodeStart + (zoomNode * zoomObj->NodeStep),
+                     sampFreq, isComplex, zoomObj->FFT);
+ }
+
+ /// <summary>
+ ///    Zoom-FFT   
+ /// </summary>
+ /// <param name="freqNode">  . </param>
+ /// <param name="sampFreq">  . </param>
+ /// <param name="isComplex">  ? </param>
+ /// <param name="zoomObj">  Zoom-FFT,   
+ /// . </param>
+ double ZoomFFT_Node(double freqNode, double sampFreq, bool isComplex,
+                     CZoom_Object *zoomObj)
+ {
+     if(zoomObj->NodeStep == 0)
+     {
+         return 0;
+     }
+
+     return (FFT_Node(freqNode, sampFreq, isComplex, zoomObj->FFT) -
+             zoomObj->NodeStart) / zoomObj->NodeStep;
+ }
+
+ /// <summary>
+ ///        Zoom-FFT (
+ ///      ,   ExactFreq)
+ /// </summary>
+ /// <param name="Mag">  (M ). </param>
+ /// <param name="depth">   (). </param>
+ /// <param name="sampFreq">  . </param>
+ /// <param name="isComplex">  ? </param>
+ /// <param name="zoomObj">  Zoom-FFT,   
+ /// . </param>
+ /// <returns>  ,    . </returns>
+ double ZoomExactFreq(double *Mag, int depth, double sampFreq,
+                      bool isComplex, CZoom_Object *zoomObj)
+ {
+     int i, maxIdx;
+     double harmSum, exactNode;
+
+     //     ( - )
+     maxIdx = GetMaxIdx(Mag, 0, zoomObj->M - 1);
+     depth  = min(depth, min(maxIdx, (zoomObj->M - 1) - maxIdx));
+
+     harmSum = 0;
+     for(i = maxIdx - depth; i <= maxIdx + depth; ++i)
+     {
+         harmSum += Mag[i];
+     }
+
+     exactNode = maxIdx;
+     if(harmSum > 0)
+     {
+         exactNode = 0;
+         for(i = maxIdx - depth; i <= maxIdx + depth; ++i)
+         {
+             exactNode += (Mag[i] / harmSum) * (double)i;
+         }
+     }
+
+     return ZoomFreqNode(exactNode, sampFreq, isComplex, zoomObj);
+ }
+
+ /// <summary>
+ ///     STFT ( 
+ /// )
+ /// </summary>
+ /// <param name="stftObj">  ,   
+ /// . </param>
+ void CSTFT_Reset(CSTFT_Object *stftObj)
+ {
+     stftObj->RingPos    = 0;
+     stftObj->Filled     = 0;
+     stftObj->StepRemain = 0;
+     stftObj->FrameIdx   = 0;
+     stftObj->SlideCount = -1;
+ }
+
+ /// <summary>
+ /// ""   STFT ( FFT  )
+ /// </summary>
+ /// <param name="stftObj">  ,   
+ /// . </param>
+ void CSTFT_Destructor(CSTFT_Object *stftObj)
+ {
+     SAFE_DELETE(stftObj->Ring);
+     SAFE_DELETE(stftObj->FFT_T);
+     SAFE_DELETE(stftObj->FFT_SD);
+     SAFE_DELETE(stftObj);
+ }
+
+ /// <summary>
+ ///    STFT.    
+ /// (CFFT_SlideAllowed)     DFT
+ /// </summary>
+ /// <param name="fftObj">  FFT (   
+ ///  ). </param>
+ /// <param name="windowStep">   FFT (). </param>
+ /// <param name="useTaperWindow">   ? </param>
+ /// <param name="useNorm">   1/N? </param>
+ /// <param name="usePolyphase">   FFT? </param>
+ /// <param name="callback">   . </param>
+ /// <param name="userData">   . </param>
+ /// <returns>   (NULL -  ). </returns>
+ CSTFT_Object * CSTFT_Init(CFFT_Object *fftObj, int windowStep,
+                           bool useTaperWindow, bool useNorm,
+                           bool usePolyphase, CSTFT_Callback callback,
+                           void *userData)
+ {
+     CSTFT_Object *stftObj;
+
+     if((fftObj == NULL) || (windowStep < 1) || (callback == NULL))
+     {
+         return NULL;
+     }
+
+     stftObj = (CSTFT_Object *)calloc(1, sizeof(CSTFT_Object));
+
+     stftObj->FFT            = fftObj;
+     stftObj->WindowStep     = windowStep;
+     stftObj->UseTaperWindow = useTaperWindow;
+     stftObj->UseNorm        = useNorm;
+     stftObj->UsePolyphase   = usePolyphase;
+     stftObj->Ring           = (double *)calloc(fftObj->NN << 1, sizeof(double));
+     stftObj->FFT_T          = (double *)calloc(fftObj->NN, sizeof(double));
+     stftObj->Callback       = callback;
+     stftObj->UseSliding     = CFFT_SlideAllowed(windowStep, useTaperWindow,
+                                                 usePolyphase, fftObj);
+
+     if(stftObj->UseSliding)
+     {
+         stftObj->FFT_SD = (double *)calloc(fftObj->NN, sizeof(double));
+     }
+     stftObj->UserData       = userData;
+
+     CSTFT_Reset(stftObj);
+
+     return stftObj;
+ }
+
+ /// <summary>
+ ///    PCM    STFT. 
+ ///  (  )    ,  FFT
+ ///    ;     ( WindowStep
+ ///     N)   
+ /// </summary>
+ /// <param name="samples">  PCM (""  ""  -
+ /// ./.). </param>
+ /// <param name="count"> -  ( )  . </param>
+ /// <param name="stftObj">  ,   
+ /// . </param>
+ /// <returns> - ,    . </returns>
+ int CSTFT_Push(double *samples, int count, CSTFT_Object *stftObj)
+ {
+     CFFT_Object *fftObj = stftObj->FFT;
+     double *ring = stftObj->Ring;
+     int i, nn, part, pos, frames, period;
+
+     nn     = fftObj->NN;
+     pos    = stftObj->RingPos;
+     frames = 0;
+     period = CFFT_SlidePeriod(fftObj);
+
+     while(count > 0)
+     {
+         // -     (    )
+         part = (stftObj->Filled < fftObj->N) ?
+                (fftObj->N - stftObj->Filled) : stftObj->StepRemain;
+         part = min(part, count);
+
+         //  DFT:       
+         // (        )
+         if(stftObj->UseSliding && (stftObj->Filled >= fftObj->N) &&
+            (stftObj->SlideCount >= 0) && (stftObj->SlideCount < period))
+         {
+             fftObj->SlideDFT(stftObj->FFT_SD, CFFT_GetSDW(fftObj),
+                              ring + pos, samples, part, nn);
+
+             stftObj->SlideCount += part;
+         }
+
+         //        
+         for(i = 0; i < (part << 1); i += 2)
+         {
+             ring[pos + 0] = ring[pos + nn + 0] = samples[i + 0];
+             ring[pos + 1] = ring[pos + nn + 1] = samples[i + 1];
+             pos = (pos + 2) & (nn - 1);
+         }
+
+         samples += (part << 1);
+         count   -= part;
+
+         if(stftObj->Filled < fftObj->N)
+         {
+             stftObj->Filled += part;
+
+             if(stftObj->Filled < fftObj->N)
+             {
+                 continue;
+             }
+
+         } else
+         {
+             stftObj->StepRemain -= part;
+
+             if(stftObj->StepRemain > 0)
+             {
+                 continue;
+             }
+         }
+
+         //  :  ""     
+         if(stftObj->UseSliding)
+         {
+             //     -  FFT  
+             if((stftObj->SlideCount < 0) || (stftObj->SlideCount >= period))
+             {
+                 CFFT_Process(ring, pos, stftObj->FFT_SD, FALSE, FALSE,
+                              FALSE, TRUE, FALSE, fftObj);
+
+                 stftObj->SlideCount = 0;
+             }
+
+             CFFT_SlideOutput(stftObj->FFT_SD, stftObj->FFT_T,
+                              stftObj->UseTaperWindow, stftObj->UseNorm,
+                              fftObj);
+         } else
+         {
+             CFFT_Process(ring, pos, stftObj->FFT_T, stftObj->UseTaperWindow,
+                          FALSE, stftObj->UseNorm, TRUE, stftObj->UsePolyphase,
+                          fftObj);
+         }
+
+         stftObj->Callback(stftObj->FFT_T, stftObj->FrameIdx++,
+                           stftObj->UserData);
+
+         stftObj->StepRemain = stftObj->WindowStep;
+         ++frames;
+     }
+
+     stftObj->RingPos = pos;
+
+     return frames;
+ }
+
+ //---------------------------------------------------------------------------
+ // FFT   (float).  ,   
+ //   -    double (CFFT_Object);   
+ //     double    
+ // float.  SSE2 / AVX2  2 / 4  .
+ //---------------------------------------------------------------------------
+
+ /// <summary>
+ ///  ""   2 (float)
+ /// </summary>
+ /// <param name="FFT_T">   (re + im). </param>
+ /// <param name="n">     . </param>
+ /// <param name="h">  ""  . </param>
+ /// <param name="W">    . </param>
+ /// <param name="k0">   ""  . </param>
+ /// <param name="k1">  ()  ""  . </param>
+ void CFFT_Radix2StageF(float *FFT_T, int n, int h, float *W, int k0, int k1)
+ {
+     int i, j, k, istep;
+     float wr, wi, tempr, tempi;
+
+     istep = h << 2;
+     n <<= 1;
+     h <<= 1;
+
+     for(k = (k0 << 1); k < (k1 << 1); k += 2)
+     {
+         wr = W[k + 0];
+         wi = W[k + 1];
+
+         for(i = k; i < n; i += istep)
+         {
+             j = i + h;
+             tempr = wr * FFT_T[j + 0] - wi * FFT_T[j + 1];
+             tempi = wi * FFT_T[j + 0] + wr * FFT_T[j + 1];
+             FFT_T[j + 0]  = FFT_T[i + 0] - tempr;
+             FFT_T[j + 1]  = FFT_T[i + 1] - tempi;
+             FFT_T[i + 0] += tempr;
+             FFT_T[i + 1] += tempi;
+         }
+     }
+ }
+
+ /// <summary>
+ ///  ""   4 (float)
+ /// </summary>
+ /// <param name="FFT_T">   (re + im). </param>
+ /// <param name="n">     . </param>
+ /// <param name="h">     . </param>
+ /// <param name="W">   . </param>
+ /// <param name="direction">   (TRUE - ).
+ /// </param>
+ /// <param name="k0">   ""  . </param>
+ /// <param name="k1">  ()  ""  . </param>
+ void CFFT_Radix4StageF(float *FFT_T, int n, int h, float *W, bool direction,
+                        int k0, int k1)
+ {
+     int i, k, k3, i1, i2, i3, istep;
+     float w1r, w1i, w2r, w2i, w3r, w3i, a1r, a1i, a2r, a2i, a3r, a3i,
+           t0r, t0i, t1r, t1i, t2r, t2i, t3r, t3i;
+
+     istep = h << 3;
+     n <<= 1;
+
+     for(k = k0; k < k1; ++k)
+     {
+         w1r = W[((h << 1) + k) << 1];
+         w1i = W[(((h << 1) + k) << 1) + 1];
+         w2r = W[(h + k) << 1];
+         w2i = W[((h + k) << 1) + 1];
+
+         k3 = 3 * k;
+         if(k3 < (h << 1))
+         {
+             w3r = W[((h << 1) + k3) << 1];
+             w3i = W[(((h << 1) + k3) << 1) + 1];
+
+         } else
+         {
+             w3r = -W[k3 << 1];
+             w3i = -W[(k3 << 1) + 1];
+         }
+
+         for(i = k << 1; i < n; i += istep)
+         {
+             i1 = i  + (h << 1);
+             i2 = i1 + (h << 1);
+             i3 = i2 + (h << 1);
+
+             a1r = w2r * FFT_T[i1 + 0] - w2i * FFT_T[i1 + 1];
+             a1i = w2i * FFT_T[i1 + 0] + w2r * FFT_T[i1 + 1];
+             a2r = w1r * FFT_T[i2 + 0] - w1i * FFT_T[i2 + 1];
+             a2i = w1i * FFT_T[i2 + 0] + w1r * FFT_T[i2 + 1];
+             a3r = w3r * FFT_T[i3 + 0] - w3i * FFT_T[i3 + 1];
+             a3i = w3i * FFT_T[i3 + 0] + w3r * FFT_T[i3 + 1];
+
+             t0r = FFT_T[i + 0] + a1r;
+             t0i = FFT_T[i + 1] + a1i;
+             t1r = FFT_T[i + 0] - a1r;
+             t1i = FFT_T[i + 1] - a1i;
+             t2r = a2r + a3r;
+             t2i = a2i + a3i;
+
+             if(direction)
+             {
+                 t3r =  (a2i - a3i);
+                 t3i = -(a2r - a3r);
+
+             } else
+             {
+                 t3r = -(a2i - a3i);
+                 t3i =  (a2r - a3r);
+             }
+
+             FFT_T[i  + 0] = t0r + t2r;
+             FFT_T[i  + 1] = t0i + t2i;
+             FFT_T[i1 + 0] = t1r + t3r;
+             FFT_T[i1 + 1] = t1i + t3i;
+             FFT_T[i2 + 0] = t0r - t2r;
+             FFT_T[i2 + 1] = t0i - t2i;
+             FFT_T[i3 + 0] = t1r - t3r;
+             FFT_T[i3 + 1] = t1i - t3i;
+         }
+     }
+ }
+
+ /// <summary>
+ ///    FFT (float,   )
+ /// </summary>
+ void CFFT_GatherF(float *FFT_T, float *FFT_S, int *FFT_P, int nn)
+ {
+     int i;
+
+     for(i = 0; i < nn; ++i)
+     {
+         FFT_T[i] = FFT_S[FFT_P[i]];
+     }
+ }
+
+ /// <summary>
+ ///    FFT     (float)
+ /// </summary>
+ void CFFT_GatherTWF(float *FFT_T, float *FFT_S, int *FFT_P, float *FFT_TW,
+                     int nn)
+ {
+     int i;
+
+     for(i = 0; i < nn; ++i)
+     {
+         FFT_T[i] = FFT_TW[FFT_P[i] >> 1] * FFT_S[FFT_P[i]];
+     }
+ }
+
+ /// <summary>
+ ///    (float):   (
+ ///  )       FFT_SW
+ /// </summary>
+ /// <param name="FFT_T">   (re + im). </param>
+ /// <param name="FFT_S">   (  ). </param>
+ /// <param name="FFT_TW">   (NULL -  ). </param>
+ /// <param name="fftObj">  FFT (double)    . </param>
+ void CFFT_InPlaceGatherF(float *FFT_T, float *FFT_S, float *FFT_TW,
+                          CFFT_Object *fftObj)
+ {
+     int i, m, a, b;
+     float re, im;
+
+     if(FFT_TW != NULL)
+     {
+         for(i = 0; i < fftObj->NN; ++i)
+         {
+             FFT_T[i] = FFT_TW[i >> 1] * FFT_S[i];
+         }
+
+     } else if(FFT_T != FFT_S)
+     {
+         memmove(FFT_T, FFT_S, fftObj->NN * sizeof(float));
+     }
+
+     for(m = 0; m < (fftObj->SwapCount << 1); m += 2)
+     {
+         a = fftObj->FFT_SW[m + 0];
+         b = fftObj->FFT_SW[m + 1];
+         re = FFT_T[a + 0];
+         im = FFT_T[a + 1];
+         FFT_T[a + 0] = FFT_T[b + 0];
+         FFT_T[a + 1] = FFT_T[b + 1];
+         FFT_T[b + 0] = re;
+         FFT_T[b + 1] = im;
+     }
+ }
+
+ /// <summary>
+ ///   (WOLA, float)     
+ ///   FFT_PP:      
+ ///    ,   
+ /// </summary>
+ /// <param name="FFT_T">   (re + im, NNPoly ). </param>
+ /// <param name="FFT_S">   (  ). </param>
+ /// <param name="FFT_TW">  . </param>
+ /// <param name="fftObj">  FFT (double)   . </param>
+ void CFFT_PolyFoldF(float *FFT_T, float *FFT_S, float *FFT_TW,
+                     CFFT_Object *fftObj)
+ {
+     int a, i, j, k, blk;
+     float re, im;
+
+     blk = fftObj->BlockSize << 1;
+
+     for(a = 0; a < fftObj->NNPoly; a += blk)
+     {
+         blk = min(blk, fftObj->NNPoly - a);
+
+         for(i = a; i < (a + blk); ++i)
+         {
+             FFT_T[i] = FFT_TW[i >> 1] * FFT_S[i];
+         }
+
+         for(j = 1; j < fftObj->PolyDiv; ++j)
+         {
+             k = j * fftObj->NNPoly;
+
+             for(i = a; i < (a + blk); ++i)
+             {
+                 FFT_T[i] += FFT_TW[(k + i) >> 1] * FFT_S[k + i];
+             }
+         }
+     }
+
+     for(i = 0; i < fftObj->NNPoly; i += 2)
+     {
+         j = fftObj->FFT_PP[i];
+
+         if(i < j)
+         {
+             re = FFT_T[i + 0];
+             im = FFT_T[i + 1];
+             FFT_T[i + 0] = FFT_T[j + 0];
+             FFT_T[i + 1] = FFT_T[j + 1];
+             FFT_T[j + 0] = re;
+             FFT_T[j + 1] = im;
+         }
+     }
+ }
+
+ /// <summary>
+ ///   (float):  NPoly     
+ ///  N  ( j - ,    j)
+ /// </summary>
+ /// <param name="FFT_T">   (NNPoly   ,
+ /// NN -  ). </param>
+ /// <param name="FFT_TW">   (N .). </param>
+ /// <param name="fftObj">  FFT (double)   . </param>
+ void CFFT_PolyUnfoldF(float *FFT_T, float *FFT_TW, CFFT_Object *fftObj)
+ {
+     int i, j, k;
+
+     //       -  
+     for(j = fftObj->PolyDiv - 1; j >= 0; --j)
+     {
+         k = j * fftObj->NNPoly;
+
+         for(i = 0; i < fftObj->NNPoly; ++i)
+         {
+             FFT_T[k + i] = FFT_TW[(k + i) >> 1] * FFT_T[i];
+         }
+     }
+ }
+
+ /// <summary>
+ ///   (float)
+ /// </summary>
+ void CFFT_ScaleF(float *FFT_T, int nn, float mult)
+ {
+     int i;
+
+     for(i = 0; i < nn; ++i)
+     {
+         FFT_T[i] *= mult;
+     }
+ }
+
+#ifdef SIMD_X86
+
+ //   b * w (SSE2, float, neg = { -0.0, 0.0, -0.0, 0.0 })
+ #define SSE2_CMUL_PS(b, w, neg) \
+         _mm_add_ps(_mm_mul_ps((b), _mm_shuffle_ps((w), (w), 0xA0)), \
+                    _mm_xor_ps(_mm_mul_ps(_mm_shuffle_ps((b), (b), 0xB1), \
+                                          _mm_shuffle_ps((w), (w), 0xF5)), (neg)))
+
+ //   b * w (AVX2 + FMA, float)
+ #define AVX2_CMUL_PS(b, w) \
+         _mm256_fmaddsub_ps((b), _mm256_moveldup_ps(w), \
+                            _mm256_mul_ps(_mm256_permute_ps((b), 0xB1), \
+                                          _mm256_movehdup_ps(w)))
+
+ /// <summary>
+ ///  ""   2 (SSE2, float)
+ /// </summary>
+ SIMD_TARGET("sse2")
+ void CFFT_Radix2StageF_SSE2(float *FFT_T, int n, int h, float *W,
+                             int k0, int k1)
+ {
+     int g, k;
+     float *a, *b;
+     __m128 neg, w, x0, x1, t;
+
+     if(h < 2)
+     {
+         CFFT_Radix2StageF(FFT_T, n, h, W, k0, k1);
+         return;
+     }
+
+     neg = _mm_set_ps(0.0f, -0.0f, 0.0f, -0.0f);
+     n <<= 1;
+     h <<= 1;
+
+     for(g = 0; g < n; g += (h << 1))
+     {
+         a = FFT_T + g;
+         b = a + h;
+
+         for(k = (k0 << 1); k < (k1 << 1); k += 4)
+         {
+             w  = _mm_loadu_ps(W + k);
+             x0 = _mm_loadu_ps(a + k);
+             x1 = _mm_loadu_ps(b + k);
+             t  = SSE2_CMUL_PS(x1, w, neg);
+             _mm_storeu_ps(a + k, _mm_add_ps(x0, t));
+             _mm_storeu_ps(b + k, _mm_sub_ps(x0, t));
+         }
+     }
+ }
+
+ /// <summary>
+ ///  ""   4 (SSE2, float)
+ /// </summary>
+ SIMD_TARGET("sse2")
+ void CFFT_Radix4StageF_SSE2(float *FFT_T, int n, int h, float *W,
+                             bool direction, int k0, int k1)
+ {
+     int i, k, hh;
+     float *x;
+     __m128 neg, rot, w1, w2, w3, x0, a1, a2, a3, t0, t1, t2, t3;
+
+     if(h < 2)
+     {
+         CFFT_Radix4StageF(FFT_T, n, h, W, direction, k0, k1);
+         return;
+     }
+
+     neg = _mm_set_ps(0.0f, -0.0f, 0.0f, -0.0f);
+     rot = direction ? _mm_set_ps(-0.0f, 0.0f, -0.0f, 0.0f) :
+                       _mm_set_ps(0.0f, -0.0f, 0.0f, -0.0f);
+     hh  = h << 1;
+     n <<= 1;
+
+     for(k = (k0 << 1); k < (k1 << 1); k += 4)
+     {
+         w1 = _mm_loadu_ps(W + (hh << 1) + k);
+         w2 = _mm_loadu_ps(W + hh + k);
+         w3 = SSE2_CMUL_PS(w1, w2, neg);
+
+         for(i = k; i < n; i += (hh << 2))
+         {
+             x  = FFT_T + i;
+             x0 = _mm_loadu_ps(x);
+             a1 = _mm_loadu_ps(x + hh);
+             a2 = _mm_loadu_ps(x + (hh << 1));
+             a3 = _mm_loadu_ps(x + (hh << 1) + hh);
+             a1 = SSE2_CMUL_PS(a1, w2, neg);
+             a2 = SSE2_CMUL_PS(a2, w1, neg);
+             a3 = SSE2_CMUL_PS(a3, w3, neg);
+
+             t0 = _mm_add_ps(x0, a1);
+             t1 = _mm_sub_ps(x0, a1);
+             t2 = _mm_add_ps(a2, a3);
+             t3 = _mm_sub_ps(a2, a3);
+             t3 = _mm_xor_ps(_mm_shuffle_ps(t3, t3, 0xB1), rot);
+
+             _mm_storeu_ps(x,                  _mm_add_ps(t0, t2));
+             _mm_storeu_ps(x + hh,             _mm_add_ps(t1, t3));
+             _mm_storeu_ps(x + (hh << 1),      _mm_sub_ps(t0, t2));
+             _mm_storeu_ps(x + (hh << 1) + hh, _mm_sub_ps(t1, t3));
+         }
+     }
+ }
+
+ /// <summary>
+ ///    FFT (SSE2, float).  (re, im) 
+ ///    64- ,   -  
+ /// </summary>
+ SIMD_TARGET("sse2")
+ void CFFT_GatherF_SSE2(float *FFT_T, float *FFT_S, int *FFT_P, int nn)
+ {
+     int i;
+     __m128 x;
+
+     for(i = 0; i < nn; i += 4)
+     {
+         x = _mm_loadl_pi(_mm_setzero_ps(), (__m64 *)(FFT_S + FFT_P[i + 0]));
+         x = _mm_loadh_pi(x,                (__m64 *)(FFT_S + FFT_P[i + 2]));
+         _mm_storeu_ps(FFT_T + i, x);
+     }
+ }
+
+ /// <summary>
+ ///    FFT    
+ /// (SSE2, float)
+ /// </summary>
+ SIMD_TARGET("sse2")
+ void CFFT_GatherTWF_SSE2(float *FFT_T, float *FFT_S, int *FFT_P,
+                          float *FFT_TW, int nn)
+ {
+     int i, p0, p1;
+     __m128 x, w;
+
+     for(i = 0; i < nn; i += 4)
+     {
+         p0 = FFT_P[i + 0];
+         p1 = FFT_P[i + 2];
+         x = _mm_loadl_pi(_mm_setzero_ps(), (__m64 *)(FFT_S  + p0));
+         x = _mm_loadh_pi(x,                (__m64 *)(FFT_S  + p1));
+         w = _mm_set_ps(FFT_TW[p1 >> 1], FFT_TW[p1 >> 1],
+                        FFT_TW[p0 >> 1], FFT_TW[p0 >> 1]);
+         _mm_storeu_ps(FFT_T + i, _mm_mul_ps(x, w));
+     }
+ }
+
+ /// <summary>
+ ///   (SSE2, float)
+ /// </summary>
+ SIMD_TARGET("sse2")
+ void CFFT_ScaleF_SSE2(float *FFT_T, int nn, float mult)
+ {
+     int i;
+     __m128 m = _mm_set1_ps(mult);
+
+     for(i = 0; i + 4 <= nn; i += 4)
+     {
+         _mm_storeu_ps(FFT_T + i, _mm_mul_ps(_mm_loadu_ps(FFT_T + i), m));
+     }
+
+     for(; i < nn; ++i)
+     {
+         FFT_T[i] *= mult;
+     }
+ }
+
+#ifdef SIMD_X86_AVX2
+
+ /// <summary>
+ ///  ""   2 (AVX2 + FMA, float)
+ /// </summary>
+ SIMD_TARGET("avx2,fma")
+ void CFFT_Radix2StageF_AVX2(float *FFT_T, int n, int h, float *W,
+                             int k0, int k1)
+ {
+     int g, k;
+     float *a, *b;
+     __m256 w, x0, x1, t;
+
+     if(h < 4)
+     {
+         CFFT_Radix2StageF_SSE2(FFT_T, n, h, W, k0, k1);
+         return;
+     }
+
+     n <<= 1;
+     h <<= 1;
+
+     for(g = 0; g < n; g += (h << 1))
+     {
+         a = FFT_T + g;
+         b = a + h;
+
+         for(k = (k0 << 1); k < (k1 << 1); k += 8)
+         {
+             w  = _mm256_loadu_ps(W + k);
+             x0 = _mm256_loadu_ps(a + k);
+             x1 = _mm256_loadu_ps(b + k);
+             t  = AVX2_CMUL_PS(x1, w);
+             _mm256_storeu_ps(a + k, _mm256_add_ps(x0, t));
+             _mm256_storeu_ps(b + k, _mm256_sub_ps(x0, t));
+         }
+     }
+ }
+
+ /// <summary>
+ ///  ""   4 (AVX2 + FMA, float)
+ /// </summary>
+ SIMD_TARGET("avx2,fma")
+ void CFFT_Radix4StageF_AVX2(float *FFT_T, int n, int h, float *W,
+                             bool direction, int k0, int k1)
+ {
+     int i, k, hh;
+     float *x;
+     __m256 rot, w1, w2, w3, x0, a1, a2, a3, t0, t1, t2, t3;
+
+     if(h < 4)
+     {
+         CFFT_Radix4StageF_SSE2(FFT_T, n, h, W, direction, k0, k1);
+         return;
+     }
+
+     rot = direction ?
+           _mm256_set_ps(-0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f) :
+           _mm256_set_ps(0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f);
+     hh  = h << 1;
+     n <<= 1;
+
+     for(k = (k0 << 1); k < (k1 << 1); k += 8)
+     {
+         w1 = _mm256_loadu_ps(W + (hh << 1) + k);
+         w2 = _mm256_loadu_ps(W + hh + k);
+         w3 = AVX2_CMUL_PS(w1, w2);
+
+         for(i = k; i < n; i += (hh << 2))
+         {
+             x  = FFT_T + i;
+             x0 = _mm256_loadu_ps(x);
+             a1 = _mm256_loadu_ps(x + hh);
+             a2 = _mm256_loadu_ps(x + (hh << 1));
+             a3 = _mm256_loadu_ps(x + (hh << 1) + hh);
+             a1 = AVX2_CMUL_PS(a1, w2);
+             a2 = AVX2_CMUL_PS(a2, w1);
+             a3 = AVX2_CMUL_PS(a3, w3);
+
+             t0 = _mm256_add_ps(x0, a1);
+             t1 = _mm256_sub_ps(x0, a1);
+             t2 = _mm256_add_ps(a2, a3);
+             t3 = _mm256_sub_ps(a2, a3);
+             t3 = _mm256_xor_ps(_mm256_permute_ps(t3, 0xB1), rot);
+
+             _mm256_storeu_ps(x,                  _mm256_add_ps(t0, t2));
+             _mm256_storeu_ps(x + hh,             _mm256_add_ps(t1, t3));
+             _mm256_storeu_ps(x + (hh << 1),      _mm256_sub_ps(t0, t2));
+             _mm256_storeu_ps(x + (hh << 1) + hh, _mm256_sub_ps(t1, t3));
+         }
+     }
+ }
+
+ /// <summary>
+ ///   (AVX2, float)
+ /// </summary>
+ SIMD_TARGET("avx2")
+ void CFFT_ScaleF_AVX2(float *FFT_T, int nn, float mult)
+ {
+     int i;
+     __m256 m = _mm256_set1_ps(mult);
+
+     for(i = 0; i + 8 <= nn; i += 8)
+     {
+         _mm256_storeu_ps(FFT_T + i, _mm256_mul_ps(_mm256_loadu_ps(FFT_T + i), m));
+     }
+
+     for(; i < nn; ++i)
+     {
+         FFT_T[i] *= mult;
+     }
+ }
+
+#endif
+
+#endif
+
+ /// <summary>
+ ///     FFT (float)   SIMD
+ /// ( AVX-512  float  -   AVX2)
+ /// </summary>
+ /// <param name="fftObjF">  FFT,    . </param>
+ /// <param name="level">   SIMD (SIMD_NONE ... SIMD_AVX512). </param>
+ /// <returns>    SIMD. </returns>
+ int CFFT_SetSIMDF(CFFT_ObjectF *fftObjF, int level)
+ {
+     fftObjF->Radix2Stage = CFFT_Radix2StageF;
+     fftObjF->Radix4Stage = CFFT_Radix4StageF;
+     fftObjF->Gather      = CFFT_GatherF;
+     fftObjF->GatherTW    = CFFT_GatherTWF;
+     fftObjF->Scale       = CFFT_ScaleF;
+
+#ifdef SIMD_X86
+
+     level = min(level, CFFT_DetectSIMD());
+
+     if(level >= SIMD_SSE2)
+     {
+         fftObjF->Radix2Stage = CFFT_Radix2StageF_SSE2;
+         fftObjF->Radix4Stage = CFFT_Radix4StageF_SSE2;
+         fftObjF->Gather      = CFFT_GatherF_SSE2;
+         fftObjF->GatherTW    = CFFT_GatherTWF_SSE2;
+         fftObjF->Scale       = CFFT_ScaleF_SSE2;
+     }
+
+#ifdef SIMD_X86_AVX2
+     if(level >= SIMD_AVX2)
+     {
+         fftObjF->Radix2Stage = CFFT_Radix2StageF_AVX2;
+         fftObjF->Radix4Stage = CFFT_Radix4StageF_AVX2;
+         fftObjF->Scale       = CFFT_ScaleF_AVX2;
+         level = SIMD_AVX2;
+     }
+#endif
+
+#else
+
+     level = SIMD_NONE;
+
+#endif
+
+     fftObjF->SIMD = level;
+
+     return level;
+ }
+
+ /// <summary>
+ /// ""  FFT (float)
+ /// </summary>
+ /// <param name="fftObjF">  FFT,    . </param>
+ void CFFT_DestructorF(CFFT_ObjectF *fftObjF)
+ {
+     SAFE_DELETE(fftObjF->FFT_TW);
+     SAFE_DELETE(fftObjF->FFT_TWR);
+     SAFE_DELETE(fftObjF->FFT_TWS);
+     SAFE_DELETE(fftObjF->FFT_WD);
+     SAFE_DELETE(fftObjF->FFT_WR);
+     CFFT_Destructor(fftObjF->Base);
+     SAFE_DELETE(fftObjF);
+ }
+
+ /// <summary>
+ ///   FFT (float)
+ /// </summary>
+ /// <param name="frameWidth">  . </param>
+ /// <param name="cosTW">     (  -   ). </param>
+ /// <param name="beta">    . </param>
+ /// <param name="polyDiv2">     . </param>
+ /// <param name="engine">  ""  FFT (RADIX_2 / RADIX_4). </param>
+ CFFT_ObjectF * CFFT_InitF(int frameWidth, int cosTW, double beta,
+                           int polyDiv2, int engine)
+ {
+     int i;
+     CFFT_Object  *fftObj;
+     CFFT_ObjectF *fftObjF;
 
-     //       -  
-     //   
-     maxDiff = 0;
-     for(i = 1; i < N2; ++i)
+     // ,       (double)...
+     fftObj  = CFFT_Init(frameWidth, cosTW, beta, polyDiv2, engine);
+     fftObjF = (CFFT_ObjectF *)calloc(1, sizeof(CFFT_ObjectF));
+
+     fftObjF->Base   = fftObj;
+     fftObjF->FFT_TW = (float *)calloc(fftObj->N,  sizeof(float));
+     fftObjF->FFT_WD = (float *)calloc(fftObj->NN, sizeof(float));
+     fftObjF->FFT_WR = (float *)calloc(fftObj->NN, sizeof(float));
+
+     //...   float
+     for(i = 0; i < fftObj->N; ++i)
      {
-         FFT_T_i_Re   = FFT_T[(i << 1) + 0];
-         FFT_T_i_Im   = FFT_T[(i << 1) + 1];
-         FFT_T_N_i_Re = FFT_T[((fftObj->N - i) << 1) + 0];
-         FFT_T_N_i_Im = FFT_T[((fftObj->N - i) << 1) + 1];
+         fftObjF->FFT_TW[i] = (float)fftObj->FFT_TW[i];
+     }
 
-         lx = FFT_T_i_Re   + FFT_T_N_i_Re;
-         ly = FFT_T_i_Im   - FFT_T_N_i_Im;
-         rx = FFT_T_i_Im   + FFT_T_N_i_Im;
-         ry = FFT_T_N_i_Re - FFT_T_i_Re;
+     for(i = 0; i < fftObj->NN; ++i)
+     {
+         fftObjF->FFT_WD[i] = (float)fftObj->FFT_WD[i];
+         fftObjF->FFT_WR[i] = (float)fftObj->FFT_WR[i];
+     }
 
-         lx_ = 2 * MagL[i] * cos(ArgL[i]);
-         ly_ = 2 * MagL[i] * sin(ArgL[i]);
-         rx_ = 2 * MagR[i] * cos(ArgR[i]);
-         ry_ = 2 * MagR[i] * sin(ArgR[i]);
+     //  double   
+     SAFE_DELETE(fftObj->FFT_TW);
+     SAFE_DELETE(fftObj->FFT_WD);
+     SAFE_DELETE(fftObj->FFT_WR);
 
-         currentDiff = fabs(lx - lx_);
-         maxDiff     = (maxDiff < currentDiff) ? currentDiff : maxDiff;
+     CFFT_SetSIMDF(fftObjF, SIMD_AVX512);
 
-         currentDiff = fabs(ly - ly_);
-         maxDiff     = (maxDiff < currentDiff) ? currentDiff : maxDiff;
+     return fftObjF;
+ }
 
-         currentDiff = fabs(rx - rx_);
-         maxDiff     = (maxDiff < currentDiff) ? currentDiff : maxDiff;
+ /// <summary>
+ ///   FFT (float)
+ /// </summary>
+ /// <param name="frameWidth">  . </param>
+ /// <param name="cosTW">    . </param>
+ /// <param name="polyDiv2">     . </param>
+ CFFT_ObjectF * CFFT_Constructor_CosineF(int frameWidth, int cosTW,
+                                         int polyDiv2)
+ {
+     return CFFT_InitF(frameWidth, cosTW, MAX_KAISER_BETA, polyDiv2,
+                       DEFAULT_FFT_ENGINE);
+ }
 
-         currentDiff = fabs(ry - ry_);
-         maxDiff     = (maxDiff < currentDiff) ? currentDiff : maxDiff;
+ /// <summary>
+ ///   FFT (float)
+ /// </summary>
+ /// <param name="frameWidth">  . </param>
+ /// <param name="beta">    . </param>
+ /// <param name="polyDiv2">     . </param>
+ CFFT_ObjectF * CFFT_Constructor_KaiserF(int frameWidth, double beta,
+                                         int polyDiv2)
+ {
+     return CFFT_InitF(frameWidth, NONE, beta, polyDiv2, DEFAULT_FFT_ENGINE);
+ }
+
+ /// <summary>
+ ///    ""    - 
+ /// (float,      )
+ /// </summary>
+ /// <param name="FFT_T">   (re + im). </param>
+ /// <param name="n">     . </param>
+ /// <param name="direction">   (TRUE - ).
+ /// </param>
+ /// <param name="fftObjF">  FFT,    . </param>
+ void CFFT_TransformFlatF(float *FFT_T, int n, bool direction,
+                          CFFT_ObjectF *fftObjF)
+ {
+     int h;
+     float *W;
+
+     W = direction ? fftObjF->FFT_WD : fftObjF->FFT_WR;
+     h = 1;
+
+     if(fftObjF->Base->Engine == RADIX_4)
+     {
+         for(; (h << 2) <= n; h <<= 2)
+         {
+             fftObjF->Radix4Stage(FFT_T, n, h, W, direction, 0, h);
+         }
      }
 
-     //       
-     //    
-     selfTestResult.MaxDiff_ALG_to_EXP_to_ALG = maxDiff;
+     for(; h < n; h <<= 1)
+     {
+         fftObjF->Radix2Stage(FFT_T, n, h, W + (h << 1), 0, h);
+     }
+ }
 
-     //    ,  
-     //   -  
-     useTaperWindow = FALSE;
-     FFT_S_Offset   = 0;
-     recoverAfterTaperWindow = FALSE;
-     useNorm      = TRUE;
-     direction    = FALSE;
-     usePolyphase = FALSE;
-     CFFT_Process(FFT_T, FFT_S_Offset, FFT_S_backward, useTaperWindow,
-                  recoverAfterTaperWindow, useNorm, direction,
-                  usePolyphase, fftObj);
+ /// <summary>
+ ///    "" (float;    -
+ ///  , . CFFT_TransformBlocked)
+ /// </summary>
+ /// <param name="FFT_T">   (re + im). </param>
+ /// <param name="n">     . </param>
+ /// <param name="direction">   (TRUE - ).
+ /// </param>
+ /// <param name="fftObjF">  FFT,    . </param>
+ void CFFT_TransformF(float *FFT_T, int n, bool direction,
+                      CFFT_ObjectF *fftObjF)
+ {
+     int q;
+     float *W;
+
+     if((n < fftObjF->Base->BlockN) || (n <= fftObjF->Base->BlockSize))
+     {
+         CFFT_TransformFlatF(FFT_T, n, direction, fftObjF);
+         return;
+     }
+
+     W = direction ? fftObjF->FFT_WD : fftObjF->FFT_WR;
+
+     if(fftObjF->Base->Engine == RADIX_4)
+     {
+         q = n >> 2;
+         CFFT_TransformF(FFT_T,            q, direction, fftObjF);
+         CFFT_TransformF(FFT_T + (q << 1), q, direction, fftObjF);
+         CFFT_TransformF(FFT_T + (q << 2), q, direction, fftObjF);
+         CFFT_TransformF(FFT_T + (q * 6),  q, direction, fftObjF);
+         fftObjF->Radix4Stage(FFT_T, n, q, W, direction, 0, q);
+
+     } else
+     {
+         q = n >> 1;
+         CFFT_TransformF(FFT_T,            q, direction, fftObjF);
+         CFFT_TransformF(FFT_T + (q << 1), q, direction, fftObjF);
+         fftObjF->Radix2Stage(FFT_T, n, q, W + (q << 1), 0, q);
+     }
+ }
+
+ /// <summary>
+ ///    (float,    ): .
+ /// CFFT_GetTWS;      double
+ /// </summary>
+ /// <param name="fftObjF">  FFT,    . </param>
+ /// <returns>    (N .). </returns>
+ float * CFFT_GetTWSF(CFFT_ObjectF *fftObjF)
+ {
+     CFFT_Object *fftObj = fftObjF->Base;
+     int i, j, k;
+     double s;
+
+     if(fftObjF->FFT_TWS == NULL)
+     {
+         fftObjF->FFT_TWS = (float *)calloc(fftObj->N, sizeof(float));
+
+         for(i = 0; i < fftObj->NPoly; ++i)
+         {
+             for(j = 0, s = 0; j < fftObj->PolyDiv; ++j)
+             {
+                 k  = i + (j * fftObj->NPoly);
+                 s += (double)fftObjF->FFT_TW[k] * fftObjF->FFT_TW[k];
+             }
+
+             for(j = 0; j < fftObj->PolyDiv; ++j)
+             {
+                 k = i + (j * fftObj->NPoly);
+                 fftObjF->FFT_TWS[k] = (s == 0) ?
+                                       0 : (float)(fftObjF->FFT_TW[k] / s);
+             }
+         }
+     }
+
+     return fftObjF->FFT_TWS;
+ }
+
+ /// <summary>
+ ///    FFT (float).   
+ ///    CFFT_Process (   M ,
+ /// M = N  NPoly,   N / M ,  , 
+ /// 1 / M).     ,    CFFT_Process,
+ ///   NPoly    N  (   -
+ ///   )
+ /// </summary>
+ /// <param name="FFT_S">   
+ /// (""  ""  - ./.). </param>
+ /// <param name="FFT_S_Offset">     
+ ///   FFT_S. </param>
+ /// <param name="FFT_T">   . </param>
+ /// <param name="useTaperWindow">   ? </param>
+ /// <param name="recoverAfterTaperWindow">  
+ ///     ? </param>
+ /// <param name="useNorm">   1/N? </param>
+ /// <param name="direction">   (TRUE - ).
+ /// </param>
+ /// <param name="usePolyphase">   FFT? </param>
+ /// <param name="fftObjF">  FFT,    . </param>
+ void CFFT_ProcessF(float *FFT_S, int FFT_S_Offset, float *FFT_T,
+                    bool useTaperWindow, bool recoverAfterTaperWindow,
+                    bool useNorm, bool direction, bool usePolyphase,
+                    CFFT_ObjectF *fftObjF)
+ {
+     CFFT_Object *fftObj = fftObjF->Base;
+     int i, n, m;
+     float mult;
+
+     //  (      )
+     if(direction && useTaperWindow && usePolyphase)
+     {
+         CFFT_PolyFoldF(FFT_T, FFT_S + FFT_S_Offset, fftObjF->FFT_TW,
+                        fftObj);
+     }
+     else if((!direction) && usePolyphase)
+     {
+         //    -   NPoly 
+         fftObjF->Gather(FFT_T, FFT_S + FFT_S_Offset, fftObj->FFT_PP,
+                         fftObj->NNPoly);
+     }
+     else if(fftObj->FFT_P == NULL)
+     {
+         //    (PERMUTE_INPLACE)
+         CFFT_InPlaceGatherF(FFT_T, FFT_S + FFT_S_Offset,
+                             (direction && useTaperWindow) ? fftObjF->FFT_TW : NULL,
+                             fftObj);
+     }
+     else if(direction && useTaperWindow)
+     {
+         fftObjF->GatherTW(FFT_T, FFT_S + FFT_S_Offset, fftObj->FFT_P,
+                           fftObjF->FFT_TW, fftObj->NN);
+     }
+     else
+     {
+         fftObjF->Gather(FFT_T, FFT_S + FFT_S_Offset, fftObj->FFT_P,
+                         fftObj->NN);
+     }
+
+     n = usePolyphase ? fftObj->NNPoly : fftObj->NN;
+
+     //    M  (  CFFT_PreProcess)
+     if(!direction)
+     {
+         m    = usePolyphase ? fftObj->NPoly : fftObj->N;
+         mult = useNorm ? ((float)fftObj->N / m) : (1.0f / m);
+
+         if(mult != 1.0f)
+         {
+             fftObjF->Scale(FFT_T, n, mult);
+         }
+     }
+
+     // FFT Routine
+     CFFT_TransformF(FFT_T, n >> 1, direction, fftObjF);
+
+     if(direction && useNorm)
+     {
+         fftObjF->Scale(FFT_T, n, 1.0f / fftObj->N);
+     }
+
+     //  :    N    
+     // (  )     
+     if((!direction) && useTaperWindow && usePolyphase)
+     {
+         CFFT_PolyUnfoldF(FFT_T, recoverAfterTaperWindow ?
+                          CFFT_GetTWSF(fftObjF) : fftObjF->FFT_TW, fftObj);
+     }
+
+     //  
+     else if((!direction) && useTaperWindow && recoverAfterTaperWindow)
+     {
+         if(fftObjF->FFT_TWR == NULL)
+         {
+             fftObjF->FFT_TWR = (float *)calloc(fftObj->N, sizeof(float));
+
+             for(i = 0; i < fftObj->N; ++i)
+             {
+                 fftObjF->FFT_TWR[i] = (fftObjF->FFT_TW[i] == 0) ?
+                                       0 : (1.0f / fftObjF->FFT_TW[i]);
+             }
+         }
+
+         for(i = 0; i < fftObj->NN; ++i)
+         {
+             FFT_T[i] *= fftObjF->FFT_TWR[i >> 1];
+         }
+     }
+ }
+
+ /// <summary>
+ ///  ""  ""  (float):  
+ ///   CFFT_Explore
+ /// </summary>
+ /// <param name="FFT_T">   . </param>
+ /// <param name="MagL">  "" . </param>
+ /// <param name="MagR">  "" . </param>
+ /// <param name="ACH"> . </param>
+ /// <param name="ArgL">  "" . </param>
+ /// <param name="ArgR">  "" . </param>
+ /// <param name="PhaseLR">    . </param>
+ /// <param name="usePolyphase">   FFT? </param>
+ /// <param name="fftObjF">  FFT,    . </param>
+ void CFFT_ExploreF(float *FFT_T, float *MagL, float *MagR, float *ACH,
+                    float *ArgL, float *ArgR, float *PhaseLR,
+                    bool usePolyphase, CFFT_ObjectF *fftObjF)
+ {
+     int i, N;
+     float magL, magR, lx, ly, rx, ry, argL, argR;
+
+     N = usePolyphase ? fftObjF->Base->NPoly : fftObjF->Base->N;
+
+     // "" 
+     magL = FFT_T[0];
+     magR = FFT_T[1];
+
+     if(MagL    != NULL) MagL[0]    = magL;
+     if(MagR    != NULL) MagR[0]    = magR;
+     if(ACH     != NULL) ACH[0]     = magR / ((magL == 0) ? (float)FLOAT_MIN : magL);
+     if(ArgL    != NULL) ArgL[0]    = (float)M_PI;
+     if(ArgR    != NULL) ArgR[0]    = (float)M_PI;
+     if(PhaseLR != NULL) PhaseLR[0] = 0;
+
+     //    
+     for(i = 1; i < (N >> 1); ++i)
+     {
+         lx = FFT_T[(i << 1) + 0]       + FFT_T[((N - i) << 1) + 0];
+         ly = FFT_T[(i << 1) + 1]       - FFT_T[((N - i) << 1) + 1];
+         rx = FFT_T[(i << 1) + 1]       + FFT_T[((N - i) << 1) + 1];
+         ry = FFT_T[((N - i) << 1) + 0] - FFT_T[(i << 1) + 0];
+
+         magL = sqrtf((lx * lx) + (ly * ly)) * 0.5f;
+         magR = sqrtf((rx * rx) + (ry * ry)) * 0.5f;
+         argL = atan2f(ly, lx);
+         argR = atan2f(ry, rx);
+
+         if(MagL    != NULL) MagL[i] = magL;
+         if(MagR    != NULL) MagR[i] = magR;
+         if(ACH     != NULL) ACH[i]  = magR / ((magL == 0) ? (float)FLOAT_MIN : magL);
+         if(ArgL    != NULL) ArgL[i] = argL;
+         if(ArgR    != NULL) ArgR[i] = argR;
+         if(PhaseLR != NULL) PhaseLR[i] = (float)PhaseNorm(argR - argL);
+     }
+ }
+
+ /// <summary>
+ ///   FFT (float).    SelfTest_S,
+ ///   - MAX_FFT_DIFF_F (   16 )
+ /// </summary>
+ /// <param name="FFT_S">    (). </param>
+ /// <param name="ACH_Difference">   ("" 
+ ///  ""). </param>
+ /// <param name="fftObjF">  FFT,    . </param>
+ /// <returns>  . </returns>
+ CFFT_SelfTestResult SelfTest_SF(float *FFT_S, double ACH_Difference,
+                                 CFFT_ObjectF *fftObjF)
+ {
+     CFFT_Object *fftObj = fftObjF->Base;
+     float *FFT_S_backward, *FFT_T, *FFT_T_Poly, *MagL, *MagR, *ACH, *ArgL,
+           *ArgR, *PhaseLR;
+     int N2, i;
+     double maxDiff, lx, ly, rx, ry, lx_, ly_, rx_, ry_;
+     LARGE_INTEGER startCounter, CFFT_Process_counter, CFFT_Explore_counter, timerFrequency;
+     int N_iters = 10000;
+     CFFT_SelfTestResult selfTestResult;
+
+     FFT_S_backward = (float *)calloc(fftObj->NN, sizeof(float));
+     FFT_T          = (float *)calloc(fftObj->NN, sizeof(float));
+
+     N2 = fftObj->N >> 1;
+
+     MagL    = (float *)calloc(N2, sizeof(float));
+     MagR    = (float *)calloc(N2, sizeof(float));
+     ACH     = (float *)calloc(N2, sizeof(float));
+     ArgL    = (float *)calloc(N2, sizeof(float));
+     ArgR    = (float *)calloc(N2, sizeof(float));
+     PhaseLR = (float *)calloc(N2, sizeof(float));
 
+     //    ,  
+     CFFT_ProcessF(FFT_S, 0, FFT_T, FALSE, FALSE, TRUE, TRUE, FALSE, fftObjF);
+     CFFT_ExploreF(FFT_T, MagL, MagR, ACH, ArgL, ArgR, PhaseLR, FALSE,
+                   fftObjF);
+
+     //        
      maxDiff = 0;
-     for(i = 0; i < fftObj->N; ++i)
+     for(i = 1; i < N2; ++i)
      {
-         currentDiff = fabs(FFT_S_backward[i] - FFT_S[i]);
-         maxDiff     = (maxDiff < currentDiff) ? currentDiff : maxDiff;
+         lx = FFT_T[(i << 1) + 0] + FFT_T[((fftObj->N - i) << 1) + 0];
+         ly = FFT_T[(i << 1) + 1] - FFT_T[((fftObj->N - i) << 1) + 1];
+         rx = FFT_T[(i << 1) + 1] + FFT_T[((fftObj->N - i) << 1) + 1];
+         ry = FFT_T[((fftObj->N - i) << 1) + 0] - FFT_T[(i << 1) + 0];
+
+         lx_ = 2 * MagL[i] * cos(ArgL[i]);
+         ly_ = 2 * MagL[i] * sin(ArgL[i]);
+         rx_ = 2 * MagR[i] * cos(ArgR[i]);
+         ry_ = 2 * MagR[i] * sin(ArgR[i]);
+
+         maxDiff = max(maxDiff, fabs(lx - lx_));
+         maxDiff = max(maxDiff, fabs(ly - ly_));
+         maxDiff = max(maxDiff, fabs(rx - rx_));
+         maxDiff = max(maxDiff, fabs(ry - ry_));
      }
 
-     //     - 
-     // (  )
-     selfTestResult.MaxDiff_FORWARD_BACKWARD = maxDiff;
+     selfTestResult.MaxDiff_ALG_to_EXP_to_ALG = maxDiff;
 
-     //   , 
-     //   -  
-     useTaperWindow = TRUE;
-     FFT_S_Offset   = 0;
-     recoverAfterTaperWindow = FALSE;
-     useNorm      = TRUE;
-     direction    = TRUE;
-     usePolyphase = FALSE;
-     CFFT_Process(FFT_S, FFT_S_Offset, FFT_T, useTaperWindow,
-                  recoverAfterTaperWindow, useNorm, direction,
-                  usePolyphase, fftObj);
+     //    
+     CFFT_ProcessF(FFT_T, 0, FFT_S_backward, FALSE, FALSE, TRUE, FALSE, FALSE,
+                   fftObjF);
 
-     //    , 
-     //   -  
-     useTaperWindow = TRUE;
-     FFT_S_Offset   = 0;
-     recoverAfterTaperWindow = TRUE;
-     useNorm      = TRUE;
-     direction    = FALSE;
-     usePolyphase = FALSE;
-     CFFT_Process(FFT_T, FFT_S_Offset, FFT_S_backward, useTaperWindow,
-                  recoverAfterTaperWindow, useNorm, direction,
-                  usePolyphase, fftObj);
+     maxDiff = 0;
+     for(i = 0; i < fftObj->N; ++i)
+     {
+         maxDiff = max(maxDiff, fabs(FFT_S_backward[i] - FFT_S[i]));
+     }
+
+     selfTestResult.MaxDiff_FORWARD_BACKWARD = maxDiff;
+
+     //    ,  -   
+     CFFT_ProcessF(FFT_S, 0, FFT_T, TRUE, FALSE, TRUE, TRUE, FALSE, fftObjF);
+     CFFT_ProcessF(FFT_T, 0, FFT_S_backward, TRUE, TRUE, TRUE, FALSE, FALSE,
+                   fftObjF);
 
      maxDiff = 0;
      for(i = (fftObj->NN / 2); i <= ((fftObj->NN * 3) / 4); ++i)
      {
-         currentDiff = fabs(FFT_S_backward[i] - FFT_S[i]);
-         maxDiff     = (maxDiff < currentDiff) ? currentDiff : maxDiff;
+         maxDiff = max(maxDiff, fabs(FFT_S_backward[i] - FFT_S[i]));
      }
 
-     //     -
-     //  (c   )
      selfTestResult.MaxDiff_FORWARD_BACKWARD_AntiTW = maxDiff;
 
      maxDiff = 0;
      for(i = 0; i < N2; ++i)
      {
-         currentDiff = fabs(ACH[i] - ACH_Difference);
-         maxDiff     = (maxDiff < currentDiff) ? currentDiff : maxDiff;
+         maxDiff = max(maxDiff, fabs(ACH[i] - ACH_Difference));
      }
 
-     //       
      selfTestResult.MaxDiff_ACH = maxDiff;
 
      maxDiff = 0;
      for(i = 0; i < N2; ++i)
      {
-         currentDiff = fabs(PhaseLR[i]);
-         maxDiff     = (maxDiff < currentDiff) ? currentDiff : maxDiff;
+         maxDiff = max(maxDiff, fabs(PhaseLR[i]));
      }
 
-     //         
      selfTestResult.MaxDiff_PhaseLR = maxDiff;
 
+     //   (NPoly ) -   N   
+     //  -  :   
+     FFT_T_Poly = (float *)calloc(fftObj->NNPoly, sizeof(float));
+
+     CFFT_ProcessF(FFT_S, 0, FFT_T, TRUE, FALSE, TRUE, TRUE, TRUE, fftObjF);
+     CFFT_ProcessF(FFT_T, 0, FFT_S_backward, TRUE, TRUE, TRUE, FALSE, TRUE,
+                   fftObjF);
+     CFFT_ProcessF(FFT_S_backward, 0, FFT_T_Poly, TRUE, FALSE, TRUE, TRUE,
+                   TRUE, fftObjF);
+
+     maxDiff = 0;
+     for(i = 0; i < fftObj->NNPoly; ++i)
+     {
+         maxDiff = max(maxDiff, fabs(FFT_T_Poly[i] - FFT_T[i]));
+     }
+
+     SAFE_DELETE(FFT_T_Poly);
+
+     selfTestResult.MaxDiff_FORWARD_BACKWARD_Poly = maxDiff;
+
      // Performance Test
      QueryPerformanceFrequency(&timerFrequency);
      CFFT_Process_counter.QuadPart = CFFT_Explore_counter.QuadPart = 0;
-               
-     //    ,  
-     //   -  
-     useTaperWindow = FALSE;
-     FFT_S_Offset   = 0;
-     recoverAfterTaperWindow = FALSE;
-     useNorm      = FALSE;
-     direction    = TRUE;
-     usePolyphase = FALSE;
 
-     // CFFT_Process_time
      startCounter.QuadPart = 0;
      QueryPerformanceCounter(&startCounter);
      for (i = 0; i < N_iters; ++i)
      {
-        CFFT_Process(FFT_S, FFT_S_Offset, FFT_T, useTaperWindow,
-                     recoverAfterTaperWindow, useNorm, direction,
-                     usePolyphase, fftObj);
+        CFFT_ProcessF(FFT_S, 0, FFT_T, FALSE, FALSE, FALSE, TRUE, FALSE,
+                      fftObjF);
      }
      QueryPerformanceCounter(&CFFT_Process_counter);
      CFFT_Process_counter.QuadPart -= startCounter.QuadPart;
      selfTestResult.CFFT_Process_time  = (long double)CFFT_Process_counter.QuadPart / (long double)timerFrequency.QuadPart;
      selfTestResult.CFFT_Process_time /= (double)N_iters;
 
-     // CFFT_Explore_time
      startCounter.QuadPart = 0;
      QueryPerformanceCounter(&startCounter);
      for (i = 0; i < N_iters; ++i)
      {
-        CFFT_Explore(FFT_T, MagL, MagR, ACH, ArgL, ArgR, PhaseLR,
-                     usePolyphase, fftObj);
+        CFFT_ExploreF(FFT_T, MagL, MagR, ACH, ArgL, ArgR, PhaseLR, FALSE,
+                      fftObjF);
      }
      QueryPerformanceCounter(&CFFT_Explore_counter);
      CFFT_Explore_counter.QuadPart -= startCounter.QuadPart;
      selfTestResult.CFFT_Explore_time  = (long double)CFFT_Explore_counter.QuadPart / (long double)timerFrequency.QuadPart;
      selfTestResult.CFFT_Explore_time /= (double)N_iters;
-          
-     //    
+
+     //  float    ARG_FAST (atan2f)
+     selfTestResult.CFFT_ExploreFast_time = selfTestResult.CFFT_Explore_time;
+
+     selfTestResult.CFFT_Init_time = CFFT_InitTime(fftObjF->Base,
+                                                   N_iters / 100);
+
+     //  FFT    double
+     selfTestResult.MaxDiff_REAL_to_COMPLEX       = 0;
+     selfTestResult.MaxDiff_REAL_FORWARD_BACKWARD = 0;
+
+     //  DFT     
+     //  double
+     selfTestResult.MaxDiff_SLIDING = 0;
+     selfTestResult.MaxDiff_BINS    = 0;
+
      SAFE_DELETE(FFT_S);
      SAFE_DELETE(FFT_S_backward);
      SAFE_DELETE(FFT_T);
@@ -1009,12 +7898,14 @@
      SAFE_DELETE(ArgR);
      SAFE_DELETE(PhaseLR);
 
-     //     
-     if(selfTestResult.MaxDiff_ACH                     <= MAX_FFT_DIFF &&
-        selfTestResult.MaxDiff_ALG_to_EXP_to_ALG       <= MAX_FFT_DIFF &&
-        selfTestResult.MaxDiff_FORWARD_BACKWARD        <= MAX_FFT_DIFF &&
-        selfTestResult.MaxDiff_FORWARD_BACKWARD_AntiTW <= MAX_FFT_DIFF &&
-        selfTestResult.MaxDiff_PhaseLR                 <= MAX_FFT_DIFF)
+     //      (  -
+     // :   ""    "")
+     if(selfTestResult.MaxDiff_ACH                     <= MAX_FFT_DIFF_F * ACH_Difference &&
+        selfTestResult.MaxDiff_ALG_to_EXP_to_ALG       <= MAX_FFT_DIFF_F &&
+        selfTestResult.MaxDiff_FORWARD_BACKWARD        <= MAX_FFT_DIFF_F &&
+        selfTestResult.MaxDiff_FORWARD_BACKWARD_AntiTW <= MAX_FFT_DIFF_F &&
+        selfTestResult.MaxDiff_FORWARD_BACKWARD_Poly   <= MAX_FFT_DIFF_F &&
+        selfTestResult.MaxDiff_PhaseLR                 <= MAX_FFT_DIFF_F)
      {
          selfTestResult.AllOK = TRUE;
 
@@ -1023,221 +7914,37 @@
          selfTestResult.AllOK = FALSE;
      }
 
-#ifdef DUMP_MODE
-
-     //     
-     DumpInt(&selfTestResult.AllOK,
-             1, DUMP_NAME, "AllOK.int32");
-
-     //      
-     DumpDouble(&selfTestResult.MaxDiff_ACH,
-                1, DUMP_NAME, "MaxDiff_ACH.double");
-
-     // Max.  ALG -> EXP  
-     DumpDouble(&selfTestResult.MaxDiff_ALG_to_EXP_to_ALG,
-                1, DUMP_NAME, "MaxDiff_ALG_to_EXP_to_ALG.double");
-
-     // Max.  FORVARD + BACKWARD
-     DumpDouble(&selfTestResult.MaxDiff_FORWARD_BACKWARD,
-                1, DUMP_NAME, "MaxDiff_FORWARD_BACKWARD.double");
-
-     //...  + .  TW
-     DumpDouble(&selfTestResult.MaxDiff_FORWARD_BACKWARD_AntiTW,
-                1, DUMP_NAME, "MaxDiff_FORWARD_BACKWARD_AntiTW.double");
-
-     // .      
-     DumpDouble(&selfTestResult.MaxDiff_PhaseLR,
-                1, DUMP_NAME, "MaxDiff_PhaseLR.double");
-
-     //   CFFT_Process()
-     DumpDouble(&selfTestResult.CFFT_Process_time,
-                1, DUMP_NAME, "CFFT_Process_time.double");
-     
-     //   CFFT_Explore()
-     DumpDouble(&selfTestResult.CFFT_Explore_time,
-                1, DUMP_NAME, "CFFT_Explore_time.double");
-
-#endif
-
-     //   
      return selfTestResult;
  }
 
  /// <summary>
- ///      -
- ///     (" ")
- /// </summary>
- /// <param name="ACH_Difference">    
- ///      . </param>
- /// <param name="fftObj">  FFT,    . </param>
- /// <returns>  "   
- /// -   ". </returns>
- CFFT_SelfTestResult SelfTest_RND(double ACH_Difference,
-                                  CFFT_Object *fftObj)
- {    
-     double randMult, randomValue;
-     int i;
-     
-     //    - 
-     double *FFT_S = (double *)calloc(fftObj->NN, sizeof(double));
-
-     //    
-     srand(time(NULL));
-
-     //   
-     randMult = 1E07;
-
-     //     ...
-     for(i = 0; i < fftObj->N; ++i)
-     {
-         //      
-         //(   )...
-         randomValue = (((double)rand() / (double)RAND_MAX) * randMult) -
-                       (((double)rand() / (double)RAND_MAX) * randMult);
-
-         // ""   ""   
-         //  "ACH_Difference" 
-         FFT_S[(i << 1) + 0] = randomValue / ACH_Difference;
-         FFT_S[(i << 1) + 1] = randomValue;
-     }
-
-     //   ...
-     return SelfTest_S(FFT_S, ACH_Difference, fftObj);
- }
-
- /// <summary>
- ///      
+ ///   FFT (float)     
+ ///   16 
  /// </summary>
- /// <param name="data">     . </param>
- /// <param name="startIdx">  . </param>
- /// <param name="finishIdx">  . </param>
- int GetMaxIdx(double *data, int startIdx, int finishIdx)
+ /// <param name="ACH_Difference">   ("" 
+ ///  ""). </param>
+ /// <param name="fftObjF">  FFT,    . </param>
+ /// <returns>  . </returns>
+ CFFT_SelfTestResult SelfTest_RNDF(double ACH_Difference,
+                                   CFFT_ObjectF *fftObjF)
  {
-     int i, maxValIdxL, maxValIdxR;
-     double currVal, maxVal;
-
-     //    ...
-     maxValIdxL = maxValIdxR = startIdx;
-     maxVal = data[maxValIdxL];
-
-     for(i = startIdx + 1; i <= finishIdx; ++i)
-     {
-         currVal = data[i];
+     double randomValue;
+     int i;
 
-         //     -
-         //    ...
-         if(currVal > maxVal)
-         {
-             maxValIdxL = maxValIdxR = i;
-             maxVal = currVal;
+     float *FFT_S = (float *)calloc(fftObjF->Base->NN, sizeof(float));
 
-         } else
-         //...   
-         //    
-         if(currVal == maxVal)
-         {
-             maxValIdxR = i;
-         }
-     }
+     srand(time(NULL));
 
-     return (maxValIdxL + maxValIdxR) >> 1;
- }
- 
- /// <summary>
- ///       
- /// </summary>
- /// <param name="Mag">  . </param>
- /// <param name="L">      . </param>
- /// <param name="R">      . </param>
- /// <param name="sampFreq">  . </param>
- /// <param name="isComplex">  ? </param>
- /// <param name="fftObj">  FFT,    . </param>
- /// <returns>  ,    . </returns>
- double CalcExactFreq(double *Mag, int L, int R,
-                      double sampFreq, bool isComplex,
-                      CFFT_Object *fftObj)
- {
-     int i;
-     double harmSum, exactFreqIdx;
-          
-     //   
-     harmSum = 0;
-     for(i = L; i <= R; ++i)
+     for(i = 0; i < fftObjF->Base->N; ++i)
      {
-         harmSum += Mag[i];
-     }
+         randomValue = (((double)rand() / (double)RAND_MAX) * PCM16_FULL_SCALE) -
+                       (((double)rand() / (double)RAND_MAX) * PCM16_FULL_SCALE);
 
-     //    
-     exactFreqIdx = 0;
-     for(i = L; i <= R; ++i)
-     {
-         exactFreqIdx += (Mag[i] / harmSum) * (double)i;
+         FFT_S[(i << 1) + 0] = (float)(randomValue / ACH_Difference);
+         FFT_S[(i << 1) + 1] = (float)randomValue;
      }
 
-     //   
-     return FreqNode(exactFreqIdx, sampFreq, isComplex, fftObj);
- }
-
- /// <summary>
- ///       
- /// </summary>
- /// <param name="Mag">  . </param>
- /// <param name="L">      . </param>
- /// <param name="R">      . </param>
- /// <param name="depth">  . </param>
- /// <param name="sampFreq">  . </param>
- /// <param name="isComplex">  ? </param>
- /// <param name="fftObj">  FFT,    . </param>
- /// <returns>  ,    . </returns>
- double ExactFreq(double *Mag, int L, int R, int depth,
-                  double sampFreq, bool isComplex,
-                  CFFT_Object *fftObj)
- {
-     int fft_N, FFT_NodeMax, startIdx, finishIdx, startIdx2, finishIdx2,
-         deltaStart, deltaFinish, deltaCorr;
-
-     //      
-     FFT_NodeMax = GetMaxIdx(Mag, L, R);
-   
-     //   
-     startIdx  = L;
-     finishIdx = R;
-
-     //   FFT
-     fft_N = fftObj->N;
-
-     //  
-     startIdx2  = startIdx  >= 0 ? startIdx : 0;
-     finishIdx2 = finishIdx <= (fft_N - 1) ? finishIdx : (fft_N - 1);
-
-     //       
-     deltaStart  = abs(startIdx2  - startIdx);
-     deltaFinish = abs(finishIdx2 - finishIdx);
-     deltaCorr   = max(deltaStart, deltaFinish);
-     depth      -= deltaCorr;
-
-     //   
-     startIdx  = FFT_NodeMax - depth;
-     finishIdx = FFT_NodeMax + depth;
-
-     //   
-     return CalcExactFreq(Mag, startIdx, finishIdx, sampFreq, isComplex, fftObj);
- }
-
- /// <summary>
- ///       
- /// </summary>
- /// <param name="Mag">  . </param>
- /// <param name="depth">  . </param>
- /// <param name="sampFreq">  . </param>
- /// <param name="isComplex">  ? </param>
- /// <param name="fftObj">  FFT,    . </param>
- /// <returns>  ,    . </returns>
- double ExactFreqAuto(double *Mag, int depth,
-                      double sampFreq, bool isComplex,
-                      CFFT_Object *fftObj)
- {
-     return ExactFreq(Mag, 1, (fftObj->N >> 1) - 1, depth, sampFreq, isComplex, fftObj);
+     return SelfTest_SF(FFT_S, ACH_Difference, fftObjF);
  }
 
 #endif
\ No newline at end of file
@@ -27,6 +27,33 @@
  #include <stdio.h>
  #include <direct.h>
 
+#endif
+
+ //------------------------------------
+ //- SIMD-
+ //------------------------------------
+ // !   SIMD
+ #define USE_SIMD
+ //------------------------------------
+
+#if defined(USE_SIMD) && (defined(_M_IX86)  || defined(_M_X64) || \
+                          defined(__i386__) || defined(__x86_64__))
+
+ #define SIMD_X86
+
+ #include <emmintrin.h>
+ #include <immintrin.h>
+
+ // AVX2 + FMA: VS2013  , GCC / Clang
+ #if defined(__GNUC__) || (defined(_MSC_VER) && (_MSC_VER >= 1800))
+  #define SIMD_X86_AVX2
+ #endif
+
+ // AVX-512F: VS2017  , GCC / Clang
+ #if defined(__GNUC__) || (defined(_MSC_VER) && (_MSC_VER >= 1910))
+  #define SIMD_X86_AVX512
+ #endif
+
 #endif
 
  //------------------------
@@ -39,9 +66,24 @@
  #define M_2PI                   2 * M_PI
  #define FLOAT_MIN               3.4E-38 //     float
  #define MAX_FFT_DIFF            1E-7    //   FFT
+ #define MAX_FFT_DIFF_F          5E-2    // .  FFT (float,  16 )
+ #define PCM16_FULL_SCALE        32767   //   16- 
  #define MIN_FRAME_WIDTH         8       //  ""   FFT
  #define MAX_KAISER_BETA         28      // Max. beta (Kaiser window), SL: ~240 dB
  #define MAX_PATH                256     //   
+ #define DEFAULT_FFT_ENGINE      RADIX_4 // ""  FFT  
+ #define BLOCKED_FFT_THRESHOLD   16384   //     FFT ()
+ #define BLOCKED_FFT_BLOCK       2048    //    FFT (, 32 )
+ #define PARALLEL_FFT_THRESHOLD  65536   //    ()
+ #define EXPLORE_CHUNK           128     //     
+ #define SLIDING_DFT_HOP_DIV     2       //   DFT:  <= log2(N) / DIV
+ #define SLIDING_DFT_REANCHOR    4       //    DFT ( N)
+ #define GOERTZEL_LANES          8       // - ,    
+ #define PRUNED_FFT_MIN_BINS     24      // .   ()   FFT
+ #define PRUNED_FFT_BLOCK        64      //    FFT (  )
+ #define SIMD_ALIGN              64      //   (,  )
+ #define PLAN_FILE_MAGIC         "EXFFTPLN" //    FFT (8 )
+ #define PLAN_FILE_VERSION       2       //     FFT
 
  // "" 
  #define TRUE                    1       // ""
@@ -62,6 +104,9 @@
                                ptr = NULL; \
                            }
  
+ //      SIMD_ALIGN
+ #define SIMD_ALIGN_UP(x)  (((x) + (SIMD_ALIGN - 1)) & ~(SIMD_ALIGN - 1))
+
  // min / max
  #define min(a, b) ((a) < (b) ? (a) : (b))
  #define max(a, b) ((a) > (b) ? (a) : (b))
@@ -92,6 +137,140 @@
                 ROSENFIELD
  };
 
+ //---------------------------------------------
+ //-  SIMD-
+ //---------------------------------------------
+ enum SIMD_Level {
+                SIMD_NONE,   //  
+                SIMD_SSE2,   // SSE2
+                SIMD_AVX2,   // AVX2 + FMA
+                SIMD_AVX512  // AVX-512F
+ };
+
+ //---------------------------------------------
+ //-  ""  FFT
+ //---------------------------------------------
+ enum FFT_Engine {
+                RADIX_2, //  FFT   2
+                RADIX_4  // FFT   4 (+  radix-2   log2(N))
+ };
+
+ //---------------------------------------------
+ //-     FFT
+ //---------------------------------------------
+ enum FFT_Permutation {
+                PERMUTE_TABLE,  //    FFT_P (2N )
+                PERMUTE_INPLACE //       FFT_SW (~N )
+ };
+
+ //---------------------------------------------
+ //-    () 
+ //---------------------------------------------
+ enum FFT_ArgMode {
+                ARG_EXACT,      // atan2   
+                ARG_FAST        //   ( < 1E-7 )
+ };
+
+ //---------------------------------------------
+ //-   PCM (,  L / R)
+ //---------------------------------------------
+ enum PCM_Format {
+                PCM_INT16,  // 16   
+                PCM_INT24,  // 24    (3 , little-endian)
+                PCM_INT32,  // 32   
+                PCM_FLOAT32 // float
+ };
+
+ //--------------------------------------
+ //-  "   FFT"
+ //--------------------------------------
+ //  :  part  parts (part == 0 -  )
+ typedef void (*CFFT_PoolTask)(void *ctx, int part, int parts);
+
+ struct CFFT_Pool;
+
+ typedef struct
+ {
+     struct CFFT_Pool *Pool; // ,   
+     int               Part; //   ,  
+
+ } CFFT_PoolWorker;
+
+ typedef struct CFFT_Pool
+ {
+     //-------------------------------------------------------------------------
+     int              Threads; // -  ( )
+     void           **Handles; //    (HANDLE)
+     void           **Start;   //     (HANDLE)
+     void            *Done;    //      (HANDLE)
+     CFFT_PoolWorker *Workers; //   
+     //-------------------------------------------------------------------------
+     volatile long    Pending; // -   
+     volatile long    Busy;    //   ( )
+     volatile long    Quit;    //    
+     CFFT_PoolTask    Task;    //  
+     void            *Ctx;     //   
+     //-------------------------------------------------------------------------
+
+ } CFFT_Pool;
+
+ //-----------------------------------------------------
+ //-  " FFT" (,  )
+ //-----------------------------------------------------
+ typedef struct CFFT_Plan
+ {
+     //-------------------------------------------------------------------------
+     int     N;       //   FFT
+     int     CosTW;   //    
+     double  Beta;    //   "beta"  
+     int     PolyDiv; //  "" FFT
+     //-------------------------------------------------------------------------
+     int    *FFT_P;   //       FFT
+     int    *FFT_PP;  //   ... (  FFT)
+     double *FFT_TW;  //  
+     double *FFT_WD;  //   ( )
+     double *FFT_WR;  //   ( )
+     //-------------------------------------------------------------------------
+     volatile long Refs;     // - ,  
+     struct CFFT_Plan *Next; //    
+     //-------------------------------------------------------------------------
+     void   *MapFile;   //   (HANDLE, NULL -   )
+     void   *MapHandle; //      (HANDLE)
+     void   *MapView;   //   (   )
+     //-------------------------------------------------------------------------
+
+ } CFFT_Plan;
+
+ //-----------------------------------------------------
+ //-  "   FFT"
+ //-----------------------------------------------------
+ //        DumpInt / DumpDouble
+ // (     -   );  
+ //  SIMD_ALIGN,   
+ typedef struct
+ {
+     //-------------------------------------------------------------------------
+     char    Magic[8];   //   (PLAN_FILE_MAGIC)
+     int     Version;    //   (PLAN_FILE_VERSION)
+     int     HeaderSize; //   ()
+     int     FileSize;   //   ()
+     unsigned int Checksum; //     
+     //-------------------------------------------------------------------------
+     int     N;          //   FFT
+     int     CosTW;      //    
+     double  Beta;       //   "beta"  
+     int     PolyDiv;    //  "" FFT
+     int     NNPoly;     // -  (re + im)  FFT
+     //-------------------------------------------------------------------------
+     int     Offset_P;   //  FFT_P  (NN int)
+     int     Offset_PP;  //  FFT_PP (NNPoly int)
+     int     Offset_TW;  //  FFT_TW (N double)
+     int     Offset_WD;  //  FFT_WD (NN double)
+     int     Offset_WR;  //  FFT_WR (NN double)
+     //-------------------------------------------------------------------------
+
+ } CFFT_PlanFileHeader;
+
  //-------------------------
  //-  " FFT"
  //-------------------------
@@ -105,14 +284,89 @@
      int     CosTW;   //     (  -   )
      double  Beta;    //   "beta"       
      int     PolyDiv; //  "" FFT ("0" -  FFT)
+     int     Engine;  //  ""  FFT (RADIX_2 / RADIX_4)
+     int     Permutation; //   (PERMUTE_TABLE / PERMUTE_INPLACE)
+     int     ArgMode; //    (ARG_EXACT / ARG_FAST)
+     int     BlockN;  //  (- )    FFT
+     int     BlockSize; //   (- )  FFT
+     int     ParallelN; //  (- )  
+     CFFT_Pool *Pool; //    (NULL -  )
+     CFFT_Plan *Plan; //   (NULL -   )
      //-------------------------------------------------------------------------
      int    *FFT_P;   //       FFT
      int    *FFT_PP;  //   ... (  FFT)
-     double *FFT_TW;  //  
+     int    *FFT_SW;  //       (NULL -  FFT_P)
+     int     SwapCount; // -  
+     double *FFT_TW;  //   (N .,   re  im)
+     double *FFT_TWR; //    (  )
+     double *FFT_TWS; //    (  )
+     double *FFT_WD;  //   ( )
+     double *FFT_WR;  //   ( )
+     double *FFT_B;   //     (NULL - )
+     int     BufferSize; //    ()
+     double *FFT_PS;  //      (PolyDiv
+                      //   2N / PolyDiv , NULL -  )
+     int     PolyPos; //      
+     double *FFT_SD;  //   DFT (   )
+     double *FFT_SDW; //    DFT (  )
+     double *SlideSrc;    //     (NULL -  )
+     int     SlideOffset; //      
+     int     SlideCount;  // -     
+     int     SlideHop;    // .   (; 0 -  N, < 0 - )
+     int     SlideReanchor; //   (; 0 -  )
+     //-------------------------------------------------------------------------
+     int     SIMD;    //  SIMD- (   )
+     void  (*Radix2Stage)(double *FFT_T, int n, int h, double *W,
+                          int k0, int k1);
+     void  (*Radix4Stage)(double *FFT_T, int n, int h, double *W,
+                          bool direction, int k0, int k1);
+     void  (*Gather)(double *FFT_T, double *FFT_S, int *FFT_P, int nn);
+     void  (*GatherTW)(double *FFT_T, double *FFT_S, int *FFT_P, double *FFT_TW,
+                       int nn);
+     void  (*FoldTW)(double *FFT_T, double *FFT_S, double *FFT_TW, int nn,
+                     bool accumulate);
+     void  (*Scale)(double *FFT_T, int nn, double mult);
+     void  (*ScaleTW)(double *FFT_T, double *FFT_TWR, int nn);
+     void  (*Magnitude)(double *Z, int n, double *Mag);
+     void  (*Argument)(double *Z, int n, double *Arg);
+     void  (*SlideDFT)(double *FFT_SD, double *FFT_SDW, double *FFT_Old,
+                       double *FFT_New, int count, int nn);
+     void  (*SlideTW)(double *FFT_T, double *FFT_SD, double *c, int nn,
+                      int a, int b);
+     void  (*Goertzel)(double *FFT_S, double *FFT_TW, int n, double *sign,
+                       double *lambda, double *state);
      //-------------------------------------------------------------------------
 
  } CFFT_Object;
 
+ //--------------------------------------------------
+ //-  " FFT   (float)"
+ //--------------------------------------------------
+ typedef struct
+ {
+     //-------------------------------------------------------------------------
+     CFFT_Object *Base; //  FFT: , ,  (
+                        //  double   )
+     //-------------------------------------------------------------------------
+     float  *FFT_TW;    //   (N .,   re  im)
+     float  *FFT_TWR;   //    (  )
+     float  *FFT_TWS;   //    (  )
+     float  *FFT_WD;    //   ( )
+     float  *FFT_WR;    //   ( )
+     //-------------------------------------------------------------------------
+     int     SIMD;      //  SIMD- (   )
+     void  (*Radix2Stage)(float *FFT_T, int n, int h, float *W,
+                          int k0, int k1);
+     void  (*Radix4Stage)(float *FFT_T, int n, int h, float *W,
+                          bool direction, int k0, int k1);
+     void  (*Gather)(float *FFT_T, float *FFT_S, int *FFT_P, int nn);
+     void  (*GatherTW)(float *FFT_T, float *FFT_S, int *FFT_P, float *FFT_TW,
+                       int nn);
+     void  (*Scale)(float *FFT_T, int nn, float mult);
+     //-------------------------------------------------------------------------
+
+ } CFFT_ObjectF;
+
  //---------------------------------------------
  //-  "  CFFT"
  //---------------------------------------------
@@ -125,11 +379,78 @@
      double MaxDiff_ALG_to_EXP_to_ALG; // Max.  ALG -> EXP  
      double MaxDiff_FORWARD_BACKWARD;  // Max.  FORVARD + BACKWARD
      double MaxDiff_FORWARD_BACKWARD_AntiTW; //...  + .  TW
+     double MaxDiff_FORWARD_BACKWARD_Poly;   //...    FFT
+     double MaxDiff_REAL_to_COMPLEX; // Max.  . FFT - 
+     double MaxDiff_REAL_FORWARD_BACKWARD; //...FORVARD + BACKWARD . FFT
+     double MaxDiff_SLIDING;   // Max. .   DFT  FFT
+     double MaxDiff_BINS;      // Max.   
      double MaxDiff_PhaseLR;   // .      
      double CFFT_Process_time; //   CFFT_Process()
      double CFFT_Explore_time; //   CFFT_Explore()
+     double CFFT_ExploreFast_time; // ...    ARG_FAST
+     double CFFT_Init_time;    //     FFT
      //-------------------------------------------------------------------------
 
  } CFFT_SelfTestResult;
 
+ //----------------------------------------
+ //-  "  STFT"
+ //----------------------------------------
+ //   :   ( CFFT_Process),
+ //      
+ typedef void (*CSTFT_Callback)(double *FFT_T, int frameIdx, void *userData);
+
+ typedef struct
+ {
+     //-------------------------------------------------------------------------
+     CFFT_Object *FFT;        //  FFT (  )
+     int     WindowStep;      //   FFT ()
+     bool    UseTaperWindow;  //   ?
+     bool    UseNorm;         //   1/N?
+     bool    UsePolyphase;    //   FFT?
+     bool    UseSliding;      //  DFT  FFT  ?
+     //-------------------------------------------------------------------------
+     double *Ring;            //    (2 * NN : 
+                              //  -  ,   )
+     int     RingPos;         //      ()
+     int     Filled;          // -   (  )
+     int     StepRemain;      // -     
+     int     FrameIdx;        //    
+     double *FFT_T;           //   
+     double *FFT_SD;          //   DFT (NULL -  )
+     int     SlideCount;      // -    
+                              // (< 0 -    )
+     //-------------------------------------------------------------------------
+     CSTFT_Callback Callback; //   
+     void   *UserData;        //   
+     //-------------------------------------------------------------------------
+
+ } CSTFT_Object;
+
+ //----------------------------------------------------
+ //-  "  (Zoom-FFT)"
+ //----------------------------------------------------
+ //   N   M     
+ // [f1, f2] (chirp-z   :  
+ // L >= N + M - 1  FFT)
+ typedef struct
+ {
+     //-------------------------------------------------------------------------
+     CFFT_Object *FFT;        //  FFT : N,  ( )
+     CFFT_Object *Conv;       //  FFT  (L )
+     //-------------------------------------------------------------------------
+     int     M;               // -  
+     double  NodeStart;       //    ( N- FFT)
+     double  NodeStep;        //   ( N- FFT)
+     //-------------------------------------------------------------------------
+     double *ChirpIn;         //   (N  re + im)
+     double *ChirpOut;        //   (M  re + im)
+     double *Kernel;          //   ,   1/L
+                              // (L  re + im)
+     double *WorkL;           //   ""  (L  re + im)
+     double *WorkR;           //   ""  (L  re + im)
+     //-------------------------------------------------------------------------
+
+ } CZoom_Object;
+
 #endif
\ No newline at end of file
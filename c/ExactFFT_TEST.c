@@ -19,19 +19,22 @@ extern FILE * GetStreamPointer(char *dirName, char *fileName, bool toWrite);
 
 int main(int argc, char* argv[])
 {
-    int i, frameWidth, polyDiv2, N, N2, depth, cosTW;
+    int i, frameWidth, polyDiv2, N, N2, depth, cosTW, planOK, planSize;
     double beta, ACH_Difference, sampFreq, trueFreq, exactFreq,
-           exactFreqDiff;
+           exactFreqDiff, maxDiff;
     short *FFT_S_short;
-    double *FFT_S, *FFT_T, *MagC, *MagL, *MagR, *ACH, *ArgC, *ArgL, *ArgR, *PhaseLR;
+    double *FFT_S, *FFT_T, *FFT_T_PCM, *FFT_T_Mapped, *MagC, *MagL, *MagR, *ACH, *ArgC,
+           *ArgL, *ArgR, *PhaseLR;
+    char planPath[MAX_PATH];
     int FFT_S_Offset;
     
     bool useTaperWindow, recoverAfterTaperWindow,
-         useNorm, direction, usePolyphase, simpleMode, isMirror, isComplex;
+         useNorm, direction, usePolyphase, isMirror, isComplex;
 
-    CFFT_Object *fftObj;
-    CFFT_SelfTestResult selfTestResult;
-    FILE *testSignalFile;
+    CFFT_Object *fftObj, *fftObjMapped;
+    CFFT_ObjectF *fftObjF;
+    CFFT_SelfTestResult selfTestResult, selfTestResultF;
+    FILE *testSignalFile, *planFile;
 
     // ***************************************************
 
@@ -52,9 +55,30 @@ int main(int argc, char* argv[])
     // ***************************************************
     ACH_Difference = 1000;
     selfTestResult = SelfTest_RND(ACH_Difference, fftObj);
+
+    // ...    FFT (float)    
+    fftObjF = CFFT_Constructor_CosineF(frameWidth, cosTW, polyDiv2);
+    selfTestResultF = SelfTest_RNDF(ACH_Difference, fftObjF);
+
+    DumpInt(&selfTestResultF.AllOK, 1, DUMP_NAME, "AllOK_F.int32");
+    DumpDouble(&selfTestResultF.MaxDiff_ACH,
+               1, DUMP_NAME, "MaxDiff_ACH_F.double");
+    DumpDouble(&selfTestResultF.MaxDiff_FORWARD_BACKWARD,
+               1, DUMP_NAME, "MaxDiff_FORWARD_BACKWARD_F.double");
+    DumpDouble(&selfTestResultF.MaxDiff_FORWARD_BACKWARD_AntiTW,
+               1, DUMP_NAME, "MaxDiff_FORWARD_BACKWARD_AntiTW_F.double");
+    DumpDouble(&selfTestResultF.CFFT_Process_time,
+               1, DUMP_NAME, "CFFT_Process_time_F.double");
+
+    printf("\nSelfTest: double - %s, float - %s",
+           selfTestResult.AllOK  ? "OK" : "FAILED",
+           selfTestResultF.AllOK ? "OK" : "FAILED");
+
     FFT_S          = (double *)calloc((frameWidth << 1), sizeof(double));
     FFT_S_short    = (short  *)calloc((frameWidth << 1), sizeof(short));
     FFT_T          = (double *)calloc((frameWidth << 1), sizeof(double));
+    FFT_T_PCM      = (double *)calloc((frameWidth << 1), sizeof(double));
+    FFT_T_Mapped   = (double *)calloc((frameWidth << 1), sizeof(double));
 
     // (  FFT / 2) -     
     N  = fftObj->N;
@@ -101,6 +125,21 @@ int main(int argc, char* argv[])
                  usePolyphase, fftObj);
     DumpDouble(FFT_T, (frameWidth << 1), DUMP_NAME, "FFT_T.double");
 
+    //     16-  - 
+    //    CFFT_Process  FFT_S
+    CFFT_ProcessPCM(FFT_S_short, PCM_INT16, FFT_S_Offset, 1.0, FFT_T_PCM,
+                    useTaperWindow, useNorm, usePolyphase, fftObj);
+
+    maxDiff = 0;
+    for(i = 0; i < (frameWidth << 1); ++i)
+    {
+        maxDiff = max(maxDiff, fabs(FFT_T_PCM[i] - FFT_T[i]));
+    }
+
+    DumpDouble(&maxDiff, 1, DUMP_NAME, "MaxDiff_PCM.double");
+    printf("\nCFFT_ProcessPCM vs CFFT_Process: %s",
+           (maxDiff <= MAX_FFT_DIFF) ? "OK" : "FAILED");
+
     CFFT_Explore(FFT_T, MagL, MagR, ACH, ArgL, ArgR, PhaseLR,
                  usePolyphase, fftObj);
     DumpDouble(MagL,    N2, DUMP_NAME, "MagL.double");
@@ -125,12 +164,74 @@ int main(int argc, char* argv[])
     DumpDouble(&trueFreq,      1, DUMP_NAME, "trueFreq.double");
     DumpDouble(&exactFreqDiff, 1, DUMP_NAME, "exactFreqDiff.double");
 
+    // ***************************************************
+    // *  FFT:  -  - 
+    // ***************************************************
+    planOK = CFFT_PlanSave(fftObj, NULL, "ExactFFT_TEST.plan");
+    fftObjMapped = planOK ? CFFT_InitMapped(NULL, "ExactFFT_TEST.plan",
+                                            DEFAULT_FFT_ENGINE, TRUE) : NULL;
+    planOK = (fftObjMapped != NULL);
+
+    if(planOK)
+    {
+        //        
+        CFFT_Process(FFT_S, FFT_S_Offset, FFT_T, useTaperWindow, FALSE,
+                     useNorm, TRUE, usePolyphase, fftObj);
+        CFFT_Process(FFT_S, FFT_S_Offset, FFT_T_Mapped, useTaperWindow, FALSE,
+                     useNorm, TRUE, usePolyphase, fftObjMapped);
+
+        maxDiff = 0;
+        for(i = 0; i < (frameWidth << 1); ++i)
+        {
+            maxDiff = max(maxDiff, fabs(FFT_T_Mapped[i] - FFT_T[i]));
+        }
+
+        planOK = (maxDiff <= MAX_FFT_DIFF);
+        CFFT_Destructor(fftObjMapped);
+
+        //     -    
+        //   
+        GetFullPath(planPath, NULL, "ExactFFT_TEST.plan");
+        planFile = fopen(planPath, "r+b");
+
+        if(planFile == NULL)
+        {
+            //      -  
+            planOK = FALSE;
+        }
+        else
+        {
+            fseek(planFile, 0, SEEK_END);
+            planSize = (int)ftell(planFile);
+            fseek(planFile, planSize >> 1, SEEK_SET);
+            i = fgetc(planFile);
+            fseek(planFile, planSize >> 1, SEEK_SET);
+            fputc(i ^ 0xFF, planFile);
+            fclose(planFile);
+
+            fftObjMapped = CFFT_InitMapped(NULL, "ExactFFT_TEST.plan",
+                                           DEFAULT_FFT_ENGINE, TRUE);
+            if(fftObjMapped != NULL)
+            {
+                planOK = FALSE;
+                CFFT_Destructor(fftObjMapped);
+            }
+        }
+
+        remove(planPath);
+    }
+
+    DumpInt(&planOK, 1, DUMP_NAME, "PlanOK.int32");
+    printf("\nPlan save / map / verify: %s", planOK ? "OK" : "FAILED");
+
     // ***************************************************
     // * 
     // ***************************************************
     SAFE_DELETE(FFT_S);
     SAFE_DELETE(FFT_S_short);
     SAFE_DELETE(FFT_T);
+    SAFE_DELETE(FFT_T_PCM);
+    SAFE_DELETE(FFT_T_Mapped);
     SAFE_DELETE(MagC);
     SAFE_DELETE(MagL);
     SAFE_DELETE(MagR);
@@ -141,6 +242,7 @@ int main(int argc, char* argv[])
     SAFE_DELETE(PhaseLR);
 
     CFFT_Destructor(fftObj);
+    CFFT_DestructorF(fftObjF);
 
     return 0;
 }
\ No newline at end of file